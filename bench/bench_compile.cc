@@ -0,0 +1,496 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+/*
+ * bench-compile generates Orange programs of increasing size and times
+ * each phase of the compiler on them. For every scenario, the growth
+ * exponent of each phase is estimated by a least-squares fit of
+ * log(time) against log(program size). If any exponent exceeds the
+ * threshold, the benchmark exits with a nonzero status.
+ *
+ * Usage: bench-compile [-t threshold] [-r repetitions] [scenario...]
+ */
+
+#include <grove/Builder.h>
+#include <grove/Module.h>
+
+#include <util/file.h>
+
+#include <llvm/Support/TimeValue.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// The phases of the compiler that are timed individually.
+enum Phase
+{
+	PHASE_PARSE = 0,
+	PHASE_DEPENDENCIES,
+	PHASE_RESOLVE,
+	PHASE_BUILD,
+	PHASE_TOTAL,
+	PHASE_COUNT
+};
+
+static const char* PHASE_NAMES[PHASE_COUNT] = {
+	"parse", "deps", "resolve", "build", "total"
+};
+
+/// Phases that run faster than this (in microseconds) at the largest size
+/// are too noisy to fit and are excluded from the threshold check.
+static const double MIN_FIT_TIME = 2000.0;
+
+/// A scenario generates a program whose size scales with n.
+struct Scenario
+{
+	const char* name;
+	std::vector<unsigned> sizes;
+	std::function<std::string(unsigned)> generate;
+};
+
+/// A single measurement of a generated program.
+struct Sample
+{
+	unsigned n;
+	size_t bytes;
+	double times[PHASE_COUNT];
+};
+
+static const char* SCALAR_TYPES[] = {
+	"int8", "int16", "int32", "int64", "uint8", "uint16", "uint32", "uint64",
+	"float", "double"
+};
+
+static const unsigned NUM_SCALAR_TYPES = 10;
+
+/// N functions, each called once from the main block.
+static std::string genFunctions(unsigned n)
+{
+	std::stringstream ss;
+
+	for (unsigned i = 0; i < n; i++)
+	{
+		ss << "def f" << i << "(int a)\n";
+		ss << "\treturn a + " << i << "\n";
+		ss << "end\n\n";
+	}
+
+	ss << "var sum = 0\n";
+
+	for (unsigned i = 0; i < n; i++)
+	{
+		ss << "sum += f" << i << "(1)\n";
+	}
+
+	ss << "return 0\n";
+	return ss.str();
+}
+
+/// N locals declared and used in a single block.
+static std::string genLocals(unsigned n)
+{
+	std::stringstream ss;
+
+	ss << "def locals(int a)\n";
+
+	for (unsigned i = 0; i < n; i++)
+	{
+		ss << "\tvar v" << i << " = a + " << i << "\n";
+	}
+
+	ss << "\tvar sum = 0\n";
+
+	for (unsigned i = 0; i < n; i++)
+	{
+		ss << "\tsum += v" << i << "\n";
+	}
+
+	ss << "\treturn sum\n";
+	ss << "end\n\n";
+	ss << "locals(1)\n";
+	ss << "return 0\n";
+	return ss.str();
+}
+
+/// Blocks nested n levels deep, with a local declared at each level.
+static std::string genNesting(unsigned n)
+{
+	std::stringstream ss;
+
+	ss << "var a = 0\n";
+
+	for (unsigned i = 0; i < n; i++)
+	{
+		ss << std::string(i, '\t') << "if a < " << (i + 1) << "\n";
+		ss << std::string(i + 1, '\t') << "var n" << i << " = a\n";
+		ss << std::string(i + 1, '\t') << "a += n" << i << " + 1\n";
+	}
+
+	for (unsigned i = n; i > 0; i--)
+	{
+		ss << std::string(i - 1, '\t') << "end\n";
+	}
+
+	ss << "return 0\n";
+	return ss.str();
+}
+
+/// N overloads of one function, distinguished by their number of parameters.
+static std::string genOverloads(unsigned n)
+{
+	std::stringstream ss;
+
+	for (unsigned i = 1; i <= n; i++)
+	{
+		ss << "def overload(";
+
+		for (unsigned j = 0; j < i; j++)
+		{
+			ss << (j > 0 ? ", " : "") << "int p" << j;
+		}
+
+		ss << ")\n\treturn p0 + " << i << "\nend\n\n";
+	}
+
+	ss << "var sum = 0\n";
+
+	for (unsigned i = 1; i <= n; i++)
+	{
+		ss << "sum += overload(";
+
+		for (unsigned j = 0; j < i; j++)
+		{
+			ss << (j > 0 ? ", " : "") << j;
+		}
+
+		ss << ")\n";
+	}
+
+	ss << "return 0\n";
+	return ss.str();
+}
+
+/// One generic function instantiated with n distinct signatures.
+static std::string genGenerics(unsigned n)
+{
+	std::stringstream ss;
+
+	ss << "def generic(var a, var b, var c)\n";
+	ss << "\treturn a + b + c\n";
+	ss << "end\n\n";
+
+	for (unsigned i = 0; i < n; i++)
+	{
+		auto a = SCALAR_TYPES[i % NUM_SCALAR_TYPES];
+		auto b = SCALAR_TYPES[(i / NUM_SCALAR_TYPES) % NUM_SCALAR_TYPES];
+		auto c = SCALAR_TYPES[(i / (NUM_SCALAR_TYPES * NUM_SCALAR_TYPES)) %
+			NUM_SCALAR_TYPES];
+
+		ss << "generic((" << a << ")1, (" << b << ")2, (" << c << ")3)\n";
+	}
+
+	ss << "return 0\n";
+	return ss.str();
+}
+
+/// A single if/elif chain with n conditions.
+static std::string genElifChain(unsigned n)
+{
+	std::stringstream ss;
+
+	ss << "var a = " << n << "\n";
+	ss << "var b = 0\n";
+
+	for (unsigned i = 0; i < n; i++)
+	{
+		ss << (i == 0 ? "if" : "elif") << " a == " << i << "\n";
+		ss << "\tb = " << i << "\n";
+	}
+
+	ss << "else\n\tb = 1\nend\n\n";
+	ss << "return b - 1\n";
+	return ss.str();
+}
+
+static std::vector<Scenario> getScenarios()
+{
+	std::vector<Scenario> scenarios;
+
+	scenarios.push_back({"functions", {64, 128, 256, 512}, genFunctions});
+	scenarios.push_back({"locals", {64, 128, 256, 512}, genLocals});
+	scenarios.push_back({"nesting", {16, 32, 64, 128}, genNesting});
+	scenarios.push_back({"overloads", {8, 16, 32, 64}, genOverloads});
+	scenarios.push_back({"generics", {64, 128, 256, 512}, genGenerics});
+	scenarios.push_back({"elif", {64, 128, 256, 512}, genElifChain});
+
+	return scenarios;
+}
+
+/// Compiles the program at path once, recording the time of each phase
+/// in microseconds.
+static void measure(std::string path, double* times)
+{
+	auto start = llvm::sys::TimeValue::now();
+
+	auto builder = new Builder(path);
+	auto parsed = llvm::sys::TimeValue::now();
+
+	for (auto mod : builder->getModules())
+	{
+		mod->findDependencies();
+	}
+
+	auto searched = llvm::sys::TimeValue::now();
+
+	for (auto mod : builder->getModules())
+	{
+		mod->resolve();
+	}
+
+	auto resolved = llvm::sys::TimeValue::now();
+
+	for (auto mod : builder->getModules())
+	{
+		mod->build();
+	}
+
+	auto built = llvm::sys::TimeValue::now();
+
+	times[PHASE_PARSE] = (parsed - start).usec();
+	times[PHASE_DEPENDENCIES] = (searched - parsed).usec();
+	times[PHASE_RESOLVE] = (resolved - searched).usec();
+	times[PHASE_BUILD] = (built - resolved).usec();
+	times[PHASE_TOTAL] = (built - start).usec();
+
+	delete builder;
+}
+
+/// Generates and compiles a program of size n, keeping the fastest time of
+/// each phase across all repetitions.
+static Sample runSample(const Scenario& scenario, unsigned n, unsigned reps)
+{
+	Sample sample;
+	sample.n = n;
+
+	auto source = scenario.generate(n);
+	sample.bytes = source.size();
+
+	auto path = getTempFile("bench", "or");
+	std::ofstream file(path);
+
+	if (file.is_open() == false)
+	{
+		throw std::runtime_error("couldn't open " + path);
+	}
+
+	file << source;
+	file.close();
+
+	for (unsigned r = 0; r < reps; r++)
+	{
+		double times[PHASE_COUNT];
+
+		try
+		{
+			measure(path, times);
+		}
+		catch (std::exception& e)
+		{
+			std::remove(path.c_str());
+			throw std::runtime_error(std::string(scenario.name) + " (n = " +
+				std::to_string(n) + "): " + e.what());
+		}
+
+		for (unsigned p = 0; p < PHASE_COUNT; p++)
+		{
+			if (r == 0 || times[p] < sample.times[p])
+			{
+				sample.times[p] = times[p];
+			}
+		}
+	}
+
+	std::remove(path.c_str());
+	return sample;
+}
+
+/// Fits log(time) = k * log(bytes) + c and returns k.
+static double growthExponent(const std::vector<Sample>& samples, unsigned phase)
+{
+	double sx = 0, sy = 0, sxx = 0, sxy = 0;
+	double count = samples.size();
+
+	for (auto sample : samples)
+	{
+		double x = std::log((double)sample.bytes);
+		double y = std::log(std::max(sample.times[phase], 1.0));
+
+		sx += x;
+		sy += y;
+		sxx += x * x;
+		sxy += x * y;
+	}
+
+	double denom = count * sxx - sx * sx;
+	if (denom == 0)
+	{
+		return 0;
+	}
+
+	return (count * sxy - sx * sy) / denom;
+}
+
+static void usage()
+{
+	std::cerr << "usage: bench-compile [-t threshold] [-r repetitions] "
+	          << "[scenario...]\n\nscenarios:";
+
+	for (auto scenario : getScenarios())
+	{
+		std::cerr << " " << scenario.name;
+	}
+
+	std::cerr << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	double threshold = 1.5;
+	unsigned reps = 3;
+	std::vector<std::string> filter;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+
+		if (arg == "-t" && i + 1 < argc)
+		{
+			threshold = atof(argv[++i]);
+		}
+		else if (arg == "-r" && i + 1 < argc)
+		{
+			reps = atoi(argv[++i]);
+		}
+		else if (arg == "-h" || arg == "--help")
+		{
+			usage();
+			return 0;
+		}
+		else if (arg[0] == '-')
+		{
+			usage();
+			return 1;
+		}
+		else
+		{
+			filter.push_back(arg);
+		}
+	}
+
+	if (reps == 0)
+	{
+		reps = 1;
+	}
+
+	int failures = 0;
+
+	std::cout << std::fixed << std::setprecision(2);
+
+	for (auto scenario : getScenarios())
+	{
+		if (filter.size() > 0 && std::find(filter.begin(), filter.end(),
+			scenario.name) == filter.end())
+		{
+			continue;
+		}
+
+		std::cout << scenario.name << ":\n";
+		std::cout << "\t" << std::setw(6) << "n" << std::setw(10) << "bytes";
+
+		for (unsigned p = 0; p < PHASE_COUNT; p++)
+		{
+			std::cout << std::setw(10) << PHASE_NAMES[p];
+		}
+
+		std::cout << "  (ms)\n";
+
+		std::vector<Sample> samples;
+
+		for (auto n : scenario.sizes)
+		{
+			Sample sample;
+
+			try
+			{
+				sample = runSample(scenario, n, reps);
+			}
+			catch (std::exception& e)
+			{
+				std::cerr << "error: " << e.what() << std::endl;
+				return 1;
+			}
+
+			samples.push_back(sample);
+
+			std::cout << "\t" << std::setw(6) << sample.n
+			          << std::setw(10) << sample.bytes;
+
+			for (unsigned p = 0; p < PHASE_COUNT; p++)
+			{
+				std::cout << std::setw(10) << sample.times[p] / 1000.0;
+			}
+
+			std::cout << std::endl;
+		}
+
+		std::cout << "\t" << std::setw(16) << "exponent";
+
+		std::vector<std::string> slow_phases;
+
+		for (unsigned p = 0; p < PHASE_COUNT; p++)
+		{
+			auto exponent = growthExponent(samples, p);
+			std::cout << std::setw(10) << exponent;
+
+			bool measurable = samples.back().times[p] >= MIN_FIT_TIME;
+			if (measurable && exponent > threshold)
+			{
+				slow_phases.push_back(PHASE_NAMES[p]);
+			}
+		}
+
+		std::cout << "\n\n";
+
+		for (auto phase : slow_phases)
+		{
+			std::cerr << "FAIL: " << scenario.name << ": " << phase
+			          << " grows faster than O(size^" << threshold << ")\n";
+			failures++;
+		}
+	}
+
+	if (failures > 0)
+	{
+		std::cerr << failures << " phase(s) exceeded the growth threshold."
+		          << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,236 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+/*
+ * bench-runtime builds every kernel in bench/runtime twice: the Orange
+ * version with `orange build` and the C version with the system C compiler.
+ * Both executables are run several times and the fastest run of each is
+ * compared. A kernel's exit status is its checksum, so the Orange and C
+ * versions must agree for the comparison to count.
+ *
+ * Usage: bench-runtime [-o orange] [-c cc] [-r repetitions] [kernel...]
+ */
+
+#include <util/file.h>
+#include <util/link.h>
+
+#include <llvm/Support/TimeValue.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/// The result of benchmarking a single kernel.
+struct KernelResult
+{
+	std::string name;
+	int orange_status;
+	int c_status;
+	double orange_time;
+	double c_time;
+};
+
+/// Runs the program at path reps times, returning the fastest run in
+/// milliseconds. The exit status of the last run is stored in status.
+static double timeProgram(std::string path, unsigned reps, int& status)
+{
+	double best = -1;
+
+	for (unsigned r = 0; r < reps; r++)
+	{
+		auto start = llvm::sys::TimeValue::now();
+		status = invokeProgramWithOptions(path.c_str(), {}, true);
+		auto finish = llvm::sys::TimeValue::now();
+
+		double elapsed = (finish - start).usec() / 1000.0;
+		if (best < 0 || elapsed < best)
+		{
+			best = elapsed;
+		}
+	}
+
+	return best;
+}
+
+static std::string replaceExtension(std::string path, std::string ext)
+{
+	return path.substr(0, path.find_last_of('.')) + ext;
+}
+
+static void usage()
+{
+	std::cerr << "usage: bench-runtime [-o orange] [-c cc] [-r repetitions] "
+	          << "[kernel...]\n";
+}
+
+int main(int argc, char** argv)
+{
+	std::string orange = ORANGE_BINARY_LOCATION;
+	std::string cc = "";
+	unsigned reps = 5;
+	std::vector<std::string> filter;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+
+		if (arg == "-o" && i + 1 < argc)
+		{
+			orange = argv[++i];
+		}
+		else if (arg == "-c" && i + 1 < argc)
+		{
+			cc = argv[++i];
+		}
+		else if (arg == "-r" && i + 1 < argc)
+		{
+			reps = atoi(argv[++i]);
+		}
+		else if (arg == "-h" || arg == "--help")
+		{
+			usage();
+			return 0;
+		}
+		else if (arg[0] == '-')
+		{
+			usage();
+			return 1;
+		}
+		else
+		{
+			filter.push_back(arg);
+		}
+	}
+
+	if (reps == 0)
+	{
+		reps = 1;
+	}
+
+	if (cc == "")
+	{
+		auto path = programPath("cc");
+
+		if (path == nullptr)
+		{
+			std::cerr << "error: a C compiler could not be found on this "
+			          << "machine. Pass one with -c.\n";
+			return 1;
+		}
+
+		cc = path;
+		delete[] path;
+	}
+
+	auto proj_dir = findProjectDirectory("orange.settings.json");
+	auto kernels = getFilesRecursive(combinePaths(proj_dir, "bench/runtime/"),
+		".or");
+
+	std::sort(kernels.begin(), kernels.end());
+
+	std::vector<KernelResult> results;
+	int failures = 0;
+
+	for (auto kernel : kernels)
+	{
+		KernelResult result;
+
+		auto slash = kernel.find_last_of('/');
+		result.name = replaceExtension(kernel.substr(slash + 1), "");
+
+		if (filter.size() > 0 && std::find(filter.begin(), filter.end(),
+			result.name) == filter.end())
+		{
+			continue;
+		}
+
+		auto c_source = replaceExtension(kernel, ".c");
+		auto orange_exe = getTempFile("bench-" + result.name, "or.out");
+		auto c_exe = getTempFile("bench-" + result.name, "c.out");
+
+		int status = invokeProgramWithOptions(orange.c_str(),
+			{"build", kernel.c_str(), "-o", orange_exe.c_str()});
+
+		if (status != 0)
+		{
+			std::cerr << "error: " << result.name << ": orange build failed\n";
+			failures++;
+			continue;
+		}
+
+		status = invokeProgramWithOptions(cc.c_str(),
+			{"-O2", "-o", c_exe.c_str(), c_source.c_str()});
+
+		if (status != 0)
+		{
+			std::cerr << "error: " << result.name << ": " << cc << " failed\n";
+			std::remove(orange_exe.c_str());
+			failures++;
+			continue;
+		}
+
+		result.orange_time = timeProgram(orange_exe, reps, result.orange_status);
+		result.c_time = timeProgram(c_exe, reps, result.c_status);
+
+		std::remove(orange_exe.c_str());
+		std::remove(c_exe.c_str());
+
+		if (result.orange_status != result.c_status)
+		{
+			std::cerr << "error: " << result.name << ": checksum mismatch "
+			          << "(orange returned " << result.orange_status
+			          << ", C returned " << result.c_status << ")\n";
+			failures++;
+		}
+
+		results.push_back(result);
+	}
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << std::left << std::setw(20) << "kernel" << std::right
+	          << std::setw(14) << "orange (ms)" << std::setw(14) << "C (ms)"
+	          << std::setw(10) << "ratio" << "\n";
+
+	double log_sum = 0;
+	unsigned nratios = 0;
+
+	for (auto result : results)
+	{
+		double ratio = result.orange_time / std::max(result.c_time, 0.01);
+
+		std::cout << std::left << std::setw(20) << result.name << std::right
+		          << std::setw(14) << result.orange_time
+		          << std::setw(14) << result.c_time
+		          << std::setw(10) << ratio;
+
+		if (result.orange_status != result.c_status)
+		{
+			std::cout << "  (checksum mismatch)";
+		}
+		else
+		{
+			log_sum += std::log(ratio);
+			nratios++;
+		}
+
+		std::cout << "\n";
+	}
+
+	if (nratios > 0)
+	{
+		std::cout << "\ngeometric mean orange/C ratio: "
+		          << std::exp(log_sum / nratios) << "\n";
+	}
+
+	return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,39 @@
+/* array_sum.c: C equivalent of array_sum.or. */
+
+#include <stdint.h>
+
+static void fill(int64_t* a, int64_t n)
+{
+	for (int64_t i = 0; i < n; i++)
+	{
+		a[i] = (i * 31) % 1000;
+	}
+}
+
+static int64_t sum(int64_t* a, int64_t n)
+{
+	int64_t total = 0;
+
+	for (int64_t i = 0; i < n; i++)
+	{
+		total += a[i];
+	}
+
+	return total;
+}
+
+int main(void)
+{
+	int64_t data[100000];
+	fill(data, 100000);
+
+	int64_t total = 0;
+
+	for (int64_t r = 0; r < 2000; r++)
+	{
+		data[r] += 1;
+		total += sum(data, 100000);
+	}
+
+	return (int)(total % 256);
+}
@@ -0,0 +1,18 @@
+/* fib.c: C equivalent of fib.or. */
+
+#include <stdint.h>
+
+static int64_t fib(int64_t n)
+{
+	if (n < 2)
+	{
+		return n;
+	}
+
+	return fib(n - 1) + fib(n - 2);
+}
+
+int main(void)
+{
+	return (int)(fib(32) % 256);
+}
@@ -0,0 +1,49 @@
+/* matmul.c: C equivalent of matmul.or. */
+
+#include <stdint.h>
+
+static void init(int64_t* m, int64_t n, int64_t seed)
+{
+	for (int64_t i = 0; i < n * n; i++)
+	{
+		m[i] = (i * seed) % 17;
+	}
+}
+
+static void matmul(int64_t* a, int64_t* b, int64_t* c, int64_t n)
+{
+	for (int64_t i = 0; i < n; i++)
+	{
+		for (int64_t j = 0; j < n; j++)
+		{
+			int64_t acc = 0;
+
+			for (int64_t k = 0; k < n; k++)
+			{
+				acc += a[i * n + k] * b[k * n + j];
+			}
+
+			c[i * n + j] = acc;
+		}
+	}
+}
+
+int main(void)
+{
+	int64_t a[40000];
+	int64_t b[40000];
+	int64_t c[40000];
+
+	init(a, 200, 3);
+	init(b, 200, 7);
+	matmul(a, b, c, 200);
+
+	int64_t checksum = 0;
+
+	for (int64_t i = 0; i < 40000; i++)
+	{
+		checksum += c[i];
+	}
+
+	return (int)(checksum % 256);
+}
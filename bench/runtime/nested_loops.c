@@ -0,0 +1,18 @@
+/* nested_loops.c: C equivalent of nested_loops.or. */
+
+#include <stdint.h>
+
+int main(void)
+{
+	int64_t sum = 0;
+
+	for (int64_t i = 0; i < 3000; i++)
+	{
+		for (int64_t j = 0; j < 3000; j++)
+		{
+			sum += (i * j) % 7;
+		}
+	}
+
+	return (int)(sum % 256);
+}
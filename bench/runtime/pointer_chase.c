@@ -0,0 +1,27 @@
+/* pointer_chase.c: C equivalent of pointer_chase.or. */
+
+#include <stdint.h>
+
+static int64_t chase(int64_t* next, int64_t steps)
+{
+	int64_t p = 0;
+
+	for (int64_t i = 0; i < steps; i++)
+	{
+		p = next[p];
+	}
+
+	return p;
+}
+
+int main(void)
+{
+	static int64_t next[262144];
+
+	for (int64_t i = 0; i < 262144; i++)
+	{
+		next[i] = (i * 1103515245 + 12345) % 262144;
+	}
+
+	return (int)(chase(next, 20000000) % 256);
+}
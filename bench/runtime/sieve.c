@@ -0,0 +1,41 @@
+/* sieve.c: C equivalent of sieve.or. */
+
+#include <stdint.h>
+
+static int64_t sieve(int8_t* composite, int64_t n)
+{
+	for (int64_t i = 0; i < n; i++)
+	{
+		composite[i] = 0;
+	}
+
+	int64_t count = 0;
+
+	for (int64_t p = 2; p < n; p++)
+	{
+		if (composite[p] == 0)
+		{
+			count++;
+
+			for (int64_t j = p * p; j < n; j += p)
+			{
+				composite[j] = 1;
+			}
+		}
+	}
+
+	return count;
+}
+
+int main(void)
+{
+	static int8_t composite[2000000];
+	int64_t total = 0;
+
+	for (int64_t r = 0; r < 10; r++)
+	{
+		total += sieve(composite, 2000000);
+	}
+
+	return (int)(total % 256);
+}
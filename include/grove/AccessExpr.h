@@ -29,6 +29,10 @@ public:
 	virtual void resolve() override;
 	virtual void build() override;
 	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
 	virtual bool isAccessible() const override;
 	
 	virtual Expression* access(OString name, Type* hint) const override;
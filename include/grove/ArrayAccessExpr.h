@@ -10,11 +10,33 @@
 
 #include "Expression.h"
 
+class Loop;
+
 class ArrayAccessExpr : public Expression
 {
 private:
 	Expression* m_array = nullptr;
 	Expression* m_idx = nullptr;
+	
+	/// The alignment of the element, when the array was given one.
+	unsigned int m_alignment = 0;
+	
+	/// Gets the number of elements in the array as an int64, if it's known.
+	llvm::Value* getElementCount() const;
+	
+	/// Finds the innermost loop around this expression that counts with the
+	/// index of this expression, if this expression runs on every iteration
+	/// of it. Its range can be checked once before the loop instead of on
+	/// every access.
+	Loop* findCountingLoop() const;
+	
+	/// Traps if vIndex is outside of the array. Only arrays with a known 
+	/// number of elements are checked.
+	void checkBounds(llvm::Value* vIndex);
+	
+	/// Works out how much of the array's alignment the element keeps, from
+	/// its offset into the array.
+	unsigned int findAlignment() const;
 public:
 	virtual ASTNode* copy() const override;
 	
@@ -25,6 +47,7 @@ public:
 	Expression* getIndex() const;
 	
 	virtual bool hasPointer() const override;
+	virtual unsigned int getAlignment() const override;
 	
 	virtual llvm::Value* getValue() const override;
 	virtual llvm::Value* getPointer() const override;
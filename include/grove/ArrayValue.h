@@ -10,10 +10,18 @@
 
 #include "Expression.h"
 
+namespace llvm { class GlobalVariable; }
+
 class ArrayValue : public Expression
 {
 private:
 	std::vector<Expression *> m_elements;
+	
+	/// The read-only global holding this array, if it's constant.
+	llvm::GlobalVariable* m_global = nullptr;
+	
+	/// Creates the read-only global holding this constant array.
+	llvm::GlobalVariable* createGlobal();
 public:
 	virtual ASTNode* copy() const override;
 	
@@ -31,5 +39,16 @@ public:
 	/// Returns whether or not all of the expressions are constant values.
 	virtual bool isConstant() const override;
 	
+	/**
+	 * Gets the read-only global holding this array. Only constant arrays 
+	 * have one, and only once they've been built.
+	 *
+	 * A constant array initializing a variable is left in its global; the 
+	 * variable decides whether to use the global directly or to copy it. 
+	 * Anywhere else, the array is copied out of its global into a stack
+	 * slot.
+	 */
+	llvm::GlobalVariable* getGlobal() const;
+	
 	ArrayValue(std::vector<Expression *> elements);
 };
\ No newline at end of file
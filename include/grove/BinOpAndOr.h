@@ -16,6 +16,8 @@ public:
 	virtual void resolve() override;
 	virtual void build() override;
 	
+	virtual bool isPure() const override;
+	
 	virtual ASTNode* copy() const override;
 	
 	BinOpAndOr(Expression* LHS, OString op, Expression* RHS);
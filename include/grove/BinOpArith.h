@@ -20,6 +20,25 @@ public:
 	virtual void resolve() override;
 	virtual void build() override;
 	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
+	/**
+	 * Computes this operation on constant values of its operands, which are 
+	 * converted in place. Returns a new Value owned by the caller, or nullptr 
+	 * if the operation would trap or overflow at run time.
+	 */
+	Value* compute(Value* lhs, Value* rhs) const;
+	
+	/**
+	 * Computes lhs op rhs for two constants of type ty the same way it's 
+	 * done at run time. Returns a new Value owned by the caller, or nullptr 
+	 * if the operation would trap or overflow.
+	 */
+	static Value* compute(OString op, const Value* lhs, const Value* rhs, 
+						  Type* ty, bool isSigned);
+	
 	virtual ASTNode* copy() const override;
 	
 	BinOpArith(Expression* LHS, OString op, Expression* RHS);
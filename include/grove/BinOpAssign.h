@@ -27,6 +27,15 @@ public:
 	/// If the operator does arithmetic, get the
 	/// arithmetic operator.
 	OString getArithOp() const;
+	
+	/**
+	 * Computes the value this assignment stores, given constant values of 
+	 * the LHS before the assignment and of the RHS. current is only needed
+	 * if the operator does arithmetic. rhs is converted to the type of the
+	 * LHS in place. Returns a new Value owned by the caller, or nullptr if 
+	 * the operation would trap or overflow at run time.
+	 */
+	Value* compute(Value* current, Value* rhs) const;
 
 	virtual ASTNode* copy() const override;
 	
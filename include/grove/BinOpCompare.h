@@ -20,6 +20,17 @@ public:
 	virtual void resolve() override;
 	virtual void build() override;
 	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
+	/**
+	 * Compares constant values of the operands, which are converted in 
+	 * place, the same way it's done at run time. Returns a new boolean Value
+	 * owned by the caller, or nullptr if either value isn't a number.
+	 */
+	Value* compute(Value* lhs, Value* rhs) const;
+	
 	virtual ASTNode* copy() const override;
 	
 	BinOpCompare(Expression* LHS, OString op, Expression* RHS);
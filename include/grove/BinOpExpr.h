@@ -11,6 +11,8 @@
 #include "Expression.h"
 #include "OString.h"
 
+class Value;
+
 /**
  * BinOpExpr is the base class for any grammar defined as expr operator expr.
  */
@@ -27,6 +29,16 @@ protected:
 	
 	bool isFloatingPointOperation() const;
 	bool areOperandsSigned() const;
+	
+	/// Gets the type of the operand that is a vector, or nullptr if neither
+	/// of them are.
+	Type* getVectorTy() const;
+	
+	/**
+	 * Converts constant values of the operands to the type the operation
+	 * is done in. Returns false if either value is null or isn't a number.
+	 */
+	bool convertOperands(Value* lhs, Value* rhs) const;
 public:
 	Expression* getLHS() const;
 	Expression* getRHS() const;
@@ -8,6 +8,8 @@
 
 #pragma once 
 
+#include <string>
+
 /**
  * This class can be used to prove specific build settings to the 
  * Builder. For example, default flags can be set and paths can be added 
@@ -15,5 +17,63 @@
  * @seealso Builder
  */
 class BuildSettings {
+private:
+	bool m_share_instances = false;
+	bool m_bounds_check = false;
+	int m_inline_threshold = 225;
+	bool m_profile_generate = false;
+	std::string m_profile_use;
+	bool m_emit_unoptimized = false;
+	bool m_fast_math = false;
+public:
+	/// Indicates whether each unique generic instance is only defined once
+	/// per build. When true, the first module to build an instance defines
+	/// it and every other module only declares it.
+	bool getShareInstances() const;
+	
+	/// Sets whether generic instances are shared between modules.
+	void setShareInstances(bool share);
+	
+	/// Indicates whether array accesses are checked against the size of the
+	/// array. An out of bounds access traps.
+	bool getBoundsCheck() const;
+	
+	/// Sets whether array accesses are bounds checked.
+	void setBoundsCheck(bool check);
+	
+	/// Gets the cost below which a call is inlined into its caller.
+	int getInlineThreshold() const;
+	
+	/// Sets the cost below which calls are inlined. Higher values inline
+	/// more aggressively.
+	void setInlineThreshold(int threshold);
+	
+	/// Indicates whether functions count how often they're called and how
+	/// often their branches are taken. The program writes the counts to a
+	/// profile when main returns.
+	bool getProfileGenerate() const;
+	
+	/// Sets whether functions are instrumented to write a profile.
+	void setProfileGenerate(bool generate);
+	
+	/// Gets the path of the profile used to optimize the build, or an empty
+	/// string if no profile is used.
+	std::string getProfileUse() const;
+	
+	/// Sets the path of the profile used to optimize the build.
+	void setProfileUse(std::string path);
+	
+	/// Indicates whether emitted files hold the code as it was generated,
+	/// before any optimizations ran.
+	bool getEmitUnoptimized() const;
+	
+	/// Sets whether emitted files hold unoptimized code.
+	void setEmitUnoptimized(bool unoptimized);
+	
+	/// Indicates whether floating point math in every function may be
+	/// optimized as if it were exact, assuming no NaNs or infinities.
+	bool getFastMath() const;
 	
+	/// Sets whether every function uses fast floating point math.
+	void setFastMath(bool fast);
 };
\ No newline at end of file
@@ -8,11 +8,17 @@
 
 #pragma once
 
+#include <ostream>
+#include <set>
 #include <string>
+#include <vector>
+
+#include "EmitKind.h"
 
 class Library;
 class BuildSettings;
 class Module;
+class Profile;
 
 namespace llvm { class TargetMachine; }
 
@@ -24,11 +30,15 @@ class Builder {
 private:
 	Library* m_library = nullptr;
 	BuildSettings* m_settings = nullptr;
+	Profile* m_profile = nullptr;
 	
 	std::string m_build_path;
 	
 	std::vector<Module *> m_modules;
 	
+	/// Mangled names of generic instances already defined by some module.
+	std::set<std::string> m_defined_instances;
+	
 	llvm::TargetMachine* m_target_machine;
 	
 	void initialize();
@@ -42,6 +52,10 @@ public:
 	/// Returns the current build settings.
 	BuildSettings* getSettings() const;
 	
+	/// Returns the profile used to optimize the build, or nullptr if there
+	/// isn't one.
+	Profile* getProfile() const;
+	
 	/// Get modules generated by the builder.
 	std::vector<Module *> getModules() const;
 	
@@ -65,9 +79,29 @@ public:
 	/// Links the code into an executable.
 	void link(std::string outputPath);
 	
+	/**
+	 * Writes each module out as a kind of file instead of linking them.
+	 * A single module is written to outputPath if it's not empty; otherwise
+	 * each module is written to the working directory, named after its 
+	 * source file with the extension of the kind of file.
+	 */
+	void emit(std::string outputPath, EmitKind kind);
+	
 	/// Runs the code JIT. Returns the exit status.
 	int run();
 	
+	/**
+	 * Claims the definition of a generic instance for the module currently 
+	 * being built. Returns true if the caller should define the instance, 
+	 * or false if it has already been defined by another module and should
+	 * only be declared. Always returns true when instances aren't shared.
+	 */
+	bool claimInstance(std::string mangled_name);
+	
+	/// Prints statistics gathered while compiling, such as the number of
+	/// instances created for each generic function.
+	void printStatistics(std::ostream& out) const;
+	
 	/// Constructs a builder with the default settings.
 	Builder(std::string path);
 	
@@ -0,0 +1,125 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Expression.h"
+#include "OString.h"
+
+namespace llvm { class MDNode; }
+namespace llvm { class Value; }
+
+/**
+ * BuiltinExpr is a call to a builtin that lowers directly to an LLVM 
+ * intrinsic instead of a function:
+ *
+ *   popcount(x), clz(x), ctz(x)  Count set bits, leading zeros, or trailing
+ *                                zeros of an integer.
+ *   bswap(x)                     Reverse the bytes of an integer whose width
+ *                                is a multiple of 16.
+ *   rotl(x, n), rotr(x, n)       Rotate an integer left or right by n bits.
+ *   prefetch(p, rw, locality)    Hint that the memory p points to will be
+ *                                read (rw = 0) or written (rw = 1) soon. 
+ *                                Locality goes from 0 (no reuse; don't keep
+ *                                it cached) to 3 (keep it in every cache).
+ *                                rw and locality default to 0 and 3.
+ *   assume(cond)                 Let the optimizer assume cond is true.
+ *   unreachable()                Mark code that can never run.
+ *   likely(cond), unlikely(cond) Give cond, hinting that it's usually true
+ *                                or usually false.
+ *
+ * The atomic builtins operate on the integer p points to, and give the
+ * value it had before the operation:
+ *
+ *   atomic_load(p)               Read the integer.
+ *   atomic_store(p, v)           Write v to the integer. Gives no value.
+ *   atomic_exchange(p, v)        Write v to the integer.
+ *   atomic_cas(p, expected, v)   Write v to the integer if it's expected.
+ *   atomic_add(p, v), atomic_sub(p, v), atomic_and(p, v), atomic_or(p, v),
+ *   atomic_xor(p, v)             Apply an operation to the integer and v.
+ *
+ * Each may take a memory ordering after its other arguments: relaxed,
+ * acquire, release, acq_rel, or seq_cst. The default is seq_cst.
+ *
+ * The vector builtins work on the lanes of vector types:
+ *
+ *   splat(x, n)                  A vector with x in each of n lanes.
+ *   shuffle(a, i...)             A vector with the lanes of a at each
+ *   shuffle(a, b, i...)          constant index i. With two vectors, the
+ *                                lanes of b follow the lanes of a.
+ *   select(mask, a, b)           Each lane of a where mask is true, and of
+ *                                b where it's false.
+ *   reduce_add(v), reduce_mul(v), reduce_min(v), reduce_max(v),
+ *   reduce_and(v), reduce_or(v)  Combine the lanes of v into one value.
+ *
+ * The integer builtins give a value of the type of x, and are folded when
+ * their arguments are constants. likely and unlikely give a bool, and are
+ * used by if statements and loops to weight the branches they create. The
+ * others don't give a value.
+ */
+class BuiltinExpr : public Expression
+{
+private:
+	OString m_name;
+	std::vector<Expression *> m_args;
+	
+	/// The memory ordering of an atomic builtin.
+	OString m_ordering = "seq_cst";
+	
+	/// Throws a code_error unless the number of arguments is in [min, max].
+	void expectArgs(unsigned int min, unsigned int max);
+	
+	/// Throws an invalid_type_error unless an argument is an integer.
+	void expectInt(Expression* arg);
+	
+	/// Gets the value of a constant integer argument, throwing a code_error
+	/// if it isn't constant or is larger than max.
+	uint64_t getConstantArg(unsigned int idx, uint64_t max) const;
+	
+	/// Builds one of the atomic builtins.
+	void buildAtomic();
+	
+	/// Checks the arguments of one of the vector builtins and sets its type.
+	void resolveVector();
+	
+	/// Builds one of the vector builtins.
+	void buildVector();
+	
+	/// Combines two values or vectors for a reduce builtin.
+	llvm::Value* combine(llvm::Value* a, llvm::Value* b) const;
+public:
+	/// Gets the name of the builtin.
+	OString getName() const;
+	
+	/// Gets the arguments passed to the builtin.
+	std::vector<Expression *> getArgs() const;
+	
+	/// Gets the memory ordering of an atomic builtin.
+	OString getOrdering() const;
+	
+	virtual ASTNode* copy() const override;
+	
+	virtual void resolve() override;
+	virtual void build() override;
+	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
+	/**
+	 * Gets branch weights for a conditional branch on the value of cond, or
+	 * nullptr if cond isn't a call to likely or unlikely. The weights are
+	 * for the successor taken when cond is true, then the one taken when
+	 * it's false, whichever blocks those are.
+	 */
+	static llvm::MDNode* getBranchWeights(Expression* cond);
+	
+	BuiltinExpr(OString name, std::vector<Expression *> args);
+};
@@ -0,0 +1,35 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once 
+
+#include <vector>
+
+#include "Block.h"
+
+class Expression;
+
+/**
+ * CaseBlocks are blocks that are executed when the condition of a switch 
+ * statement matches any one of their values.
+ */
+class CaseBlock : public Block
+{
+private:
+	std::vector<Expression *> m_values;
+public:
+	/// Gets the values this block matches.
+	std::vector<Expression *> getValues() const;
+	
+	/// Ensures that all values are constant integers.
+	virtual void resolve() override;
+	
+	virtual ASTNode* copy() const override;
+	
+	CaseBlock(std::vector<Expression *> values);
+};
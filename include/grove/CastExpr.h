@@ -25,5 +25,9 @@ public:
 	virtual void resolve() override;
 	virtual void build() override;
 	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
 	CastExpr(Type* ty, Expression* expr);
 };
\ No newline at end of file
@@ -0,0 +1,44 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once
+
+#include "Expression.h"
+
+class FunctionCall;
+
+/**
+ * ComptimeCall is a function call marked with const, which is evaluated at
+ * compile time by the Interpreter. The call is replaced with its result, so
+ * it can be used anywhere a constant can, such as in the size of an array.
+ *
+ * The arguments must be constants and the function must return a number.
+ */
+class ComptimeCall : public Expression
+{
+private:
+	FunctionCall* m_call = nullptr;
+	Value* m_result = nullptr;
+public:
+	/// Gets the call to evaluate.
+	FunctionCall* getCall() const;
+	
+	virtual ASTNode* copy() const override;
+	
+	virtual void resolve() override;
+	virtual void build() override;
+	
+	/// Returns true once the call has been evaluated.
+	virtual bool isConstant() const override;
+	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
+	ComptimeCall(FunctionCall* call);
+};
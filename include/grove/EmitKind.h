@@ -0,0 +1,25 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once 
+
+/// Defines the kinds of files a module can be written out as.
+enum EmitKind
+{
+	/// A native object file.
+	EMIT_OBJ,
+	
+	/// Native assembly.
+	EMIT_ASM,
+	
+	/// Textual LLVM IR.
+	EMIT_LLVM,
+	
+	/// LLVM bitcode.
+	EMIT_BC
+};
@@ -14,6 +14,8 @@
 
 namespace llvm { class Value; }
 
+class Value;
+
 /**
  * Expression is the base class for elements that have values and types.
  */
@@ -29,5 +31,19 @@ public:
 	
 	/// Returns whether or not this expression represents a constant value.
 	virtual bool isConstant() const;
+	
+	/// Returns whether or not this expression can be evaluated without 
+	/// side effects and without the possibility of trapping. Pure 
+	/// expressions may be evaluated even when their value isn't used.
+	virtual bool isPure() const;
+	
+	/// Returns whether or not this expression is pure and small enough that
+	/// evaluating it unconditionally is cheaper than branching around it.
+	bool isCheap() const;
+	
+	/// Evaluates this expression at compile time. Returns a new Value with 
+	/// the result, owned by the caller, or nullptr if the result isn't 
+	/// known until run time. Only valid once this expression is resolved.
+	virtual Value* fold() const;
 };
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <set>
 #include <string>
 
 #include "Block.h"
@@ -18,6 +19,9 @@
 namespace llvm { class Function; }
 namespace llvm { class BasicBlock; }
 namespace llvm { class Value; }
+namespace llvm { class AllocaInst; }
+namespace llvm { class Type; }
+namespace llvm { class BranchInst; }
 
 class Type;
 class Parameter;
@@ -27,6 +31,7 @@ class Function : public Block, public Valued, public Genericable, public Named
 private:
 	llvm::BasicBlock* m_entry = nullptr;
 	llvm::BasicBlock* m_exit = nullptr;
+	llvm::BasicBlock* m_trap = nullptr;
 	
 	llvm::Value* m_ret_value = nullptr;
 	llvm::Function* m_function = nullptr;
@@ -36,8 +41,35 @@ private:
 	Function* m_instance_of = nullptr;
 	
 	std::vector<Parameter *> m_params;
+	
+	bool m_fast_math = false;
+	
+	/// Variables that are written to in the body, found the first time
+	/// isWritten is called.
+	std::set<const Valued *> m_written;
+	bool m_found_writes = false;
+	
+	/// Gets the conditional branches of the LLVM function, in the order
+	/// their counters are stored in the profile.
+	std::vector<llvm::BranchInst *> getConditionalBranches() const;
+	
+	/// Adds counters for --profile-generate to the LLVM function. Counter 0
+	/// counts calls; each conditional branch gets a counter for the times
+	/// it was taken followed by one for the times it ran. The main function
+	/// also writes the profile before it returns.
+	void instrumentProfile();
+	
+	/// Annotates the LLVM function with the counters from the profile used
+	/// by the build. Branches get weights, and functions that are called
+	/// often or rarely are marked as hot or cold.
+	void applyProfile();
 protected:
 	virtual void createFunction();
+	
+	/// Creates a declaration of this function without a body. Used for
+	/// shared generic instances that are defined by another module.
+	virtual void declareFunction();
+	
 	virtual void createReturn();
 	virtual void setupFunction();
 	virtual void optimize();
@@ -48,6 +80,17 @@ public:
 	/// Get the exit block for this function.
 	llvm::BasicBlock* getExit() const;
 	
+	/// Gets the block that failed runtime checks in this function branch to.
+	/// It aborts the program. Created the first time it's requested.
+	llvm::BasicBlock* getTrapBlock();
+	
+	/**
+	 * Creates a stack slot of a fixed-size type at the start of the entry 
+	 * block. Slots created in the entry block are allocated once per call, 
+	 * regardless of where they're used, and can be promoted to registers.
+	 */
+	llvm::AllocaInst* createSlot(llvm::Type* ty, std::string name = "");
+	
 	/// Gets the LLVM return value.
 	llvm::Value* getRetValue() const;
 	
@@ -63,6 +106,14 @@ public:
 	/// Gets this function's return type.
 	Type* getReturnType() const;
 	
+	/**
+	 * Indicates whether a variable declared in this function may be written
+	 * to after it's declared, anywhere in this function or the functions
+	 * nested in it. Only reading elements of the variable is known to not
+	 * write to it. The body is searched once, the first time this is called.
+	 */
+	bool isWritten(const Valued* var);
+	
 	Function* getInstanceParent() const;
 	
 	void setReturnType(Type* ty);
@@ -75,12 +126,32 @@ public:
 	/// Indicates whether or not this function is a generic instance.
 	bool isInstance() const;
 	
+	/// Indicates whether or not this function can be called from outside of
+	/// its module. Exported functions have external linkage and use the C
+	/// calling convention; the others are internal and use fastcc, which
+	/// lets them be inlined and removed once nothing calls them.
+	virtual bool isExported() const;
+	
+	/**
+	 * Adds an attribute given after the signature of this function. The only
+	 * attribute is fastmath, which lets floating point math be optimized as
+	 * if it were exact. Throws a code_error for any other name.
+	 */
+	void addAttribute(OString name);
+	
+	/// Indicates whether floating point math in this function may be
+	/// reassociated and assume that there are no NaNs or infinities, either
+	/// because of the fastmath attribute or --fast-math.
+	virtual bool isFastMath() const;
+	
 	virtual ASTNode* copy() const override;
 	
 	virtual bool isGeneric() const override;
 	
 	virtual Genericable* createInstance(Type* type) override;
 	
+	virtual Type* getInstanceKey(Type* type) const override;
+	
 	virtual void findDependencies() override;
 	
 	virtual void resolve() override;
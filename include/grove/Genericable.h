@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <vector>
+
 #include "Typed.h"
 
 class Type;
@@ -22,6 +25,17 @@ class Genericable : public Typed
 {
 protected:
 	std::vector<Genericable *> m_instances;
+	
+	/// Instances keyed by their canonical type (see getInstanceKey).
+	std::unordered_map<Type *, Genericable *> m_instance_map;
+	
+	/// The number of lookups that were answered by an existing instance.
+	mutable unsigned int m_instance_hits = 0;
+	
+	/// Registers an instance created by createInstance.
+	/// @param instance The instance that was created.
+	/// @param type The type that was requested for the instance.
+	void addInstance(Genericable* instance, Type* type);
 public:
 	/// Determines whether or not this object is
 	/// actually a generic or not.
@@ -44,4 +58,17 @@ public:
 	/// @param type The type the instance should have.
 	/// @return True if an instance exists, false otherwise.
 	bool hasInstance(Type* type) const;
+	
+	/// Gets the uniqued type that instances are cached by. Any two types
+	/// that would be satisfied by the same instance have the same key.
+	/// Returns nullptr if type can't be keyed, in which case instances
+	/// are searched for one that matches.
+	/// @param type The type the instance should have.
+	virtual Type* getInstanceKey(Type* type) const;
+	
+	/// Gets all instances created from this generic.
+	std::vector<Genericable *> getInstances() const;
+	
+	/// Gets the number of times an existing instance was reused.
+	unsigned int getInstanceHits() const;
 };
\ No newline at end of file
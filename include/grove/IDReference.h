@@ -30,13 +30,22 @@ public:
 	
 	virtual bool hasPointer() const override;
 	
+	virtual unsigned int getAlignment() const override;
+	
 	virtual llvm::Value* getValue() const override;
 	
 	virtual llvm::Value* getSize() const override;
 	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
 	/// Gets the name that this node is referring to.
 	OString getName() const;
 	
+	/// Gets the node this reference was resolved to, if it's been resolved.
+	Valued* getNode() const;
+	
 	virtual bool isAccessible() const override;
 	
 	virtual Expression* access(OString name, Type* hint) const override;
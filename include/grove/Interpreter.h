@@ -0,0 +1,131 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+class ASTNode;
+class Block;
+class Expression;
+class Function;
+class IfStmt;
+class Loop;
+class Type;
+class Value;
+class Valued;
+class VarDecl;
+
+/**
+ * Interpreter runs resolved functions at compile time by walking their
+ * bodies, so that calls with constant arguments can be replaced by their
+ * results.
+ *
+ * Only numbers, booleans, and fixed-size arrays of them can be used. Code
+ * that takes addresses, calls external functions, or reads variables whose
+ * values are only known at run time can't be evaluated; neither can
+ * operations that would trap, such as dividing by zero or indexing out of
+ * bounds. Those are reported as errors at the node that can't be evaluated.
+ */
+class Interpreter
+{
+private:
+	/// The storage of a variable or parameter: one cell for a number, or
+	/// one cell per element for an array. Cells that haven't been given a
+	/// value are null.
+	typedef std::vector<Value *> Cells;
+	typedef std::map<Valued *, Cells> Frame;
+	
+	/// A cell or range of cells that can be read from or assigned to.
+	struct Location
+	{
+		Cells* cells;
+		size_t offset;
+		Type* type;
+	};
+	
+	/// What to do after a statement has been executed.
+	enum Control
+	{
+		CONTROL_NEXT,
+		CONTROL_BREAK,
+		CONTROL_CONTINUE,
+		CONTROL_RETURN
+	};
+	
+	/// The variables and parameters of each function being called.
+	std::vector<Frame> m_frames;
+	
+	/// Constants declared outside of the functions being called.
+	Frame m_globals;
+	
+	/// Functions that have been completely resolved.
+	std::set<Function *> m_resolved;
+	
+	/// The value given by the last return statement.
+	Value* m_return = nullptr;
+	
+	unsigned long m_steps = 0;
+	
+	const unsigned long m_max_steps = 10000000;
+	const unsigned int m_max_depth = 512;
+	
+	/// Throws a code_error for node with a message.
+	void fail(ASTNode* node, std::string message);
+	
+	/// Counts a node towards the number of steps taken, failing if there
+	/// have been too many.
+	void step(ASTNode* node);
+	
+	/// Gets the number of cells needed to store a value of type ty.
+	size_t getCellCount(ASTNode* node, Type* ty);
+	
+	/// Deletes the values stored in a frame.
+	void clearFrame(Frame& frame);
+	
+	/// Declares a variable in a frame, giving it its initial value.
+	void declare(VarDecl* decl, Frame& frame);
+	
+	/// Stores the value of init into cells starting at offset.
+	void initialize(Cells& cells, size_t offset, Type* ty, Expression* init);
+	
+	/// Finds the storage that an expression refers to.
+	Location locate(Expression* expr);
+	
+	/// Gets a copy of the number stored at a location.
+	Value* read(Location loc, Expression* expr);
+	
+	/// Replaces the number stored at a location. The location takes
+	/// ownership of the value.
+	void write(Location loc, Value* value);
+	
+	/// Evaluates an expression. Returns a new Value owned by the caller, or
+	/// nullptr if the expression is a call to a void function.
+	Value* evaluate(Expression* expr);
+	
+	/// Evaluates an expression as a boolean.
+	bool evaluateCondition(Expression* expr);
+	
+	Control execute(ASTNode* stmt);
+	Control executeBlock(Block* block);
+	Control executeIf(IfStmt* stmt);
+	Control executeLoop(Loop* loop);
+public:
+	/**
+	 * Calls a function with constant arguments, which are owned by the
+	 * interpreter. Returns a new Value with the result, owned by the caller,
+	 * or nullptr if the function doesn't return a value. Throws a code_error
+	 * if the call can't be evaluated; site is the node that made the call.
+	 */
+	Value* call(Function* func, std::vector<Value *> args, ASTNode* site);
+	
+	~Interpreter();
+};
@@ -9,10 +9,20 @@
 #pragma once 
 
 #include "Block.h"
+#include "OString.h"
 
 namespace llvm { class BasicBlock; }
+namespace llvm { class Value; }
+namespace llvm { class MDNode; }
+namespace llvm { class BranchInst; }
 
 class Expression;
+class Value;
+class VarDecl;
+
+/// The name of the llvm.loop operand that marks loops which must be 
+/// vectorized.
+#define LOOP_ASSERT_VECTORIZED "orange.loop.assert_vectorized"
 
 class Loop : public Block
 {
@@ -33,7 +43,38 @@ private:
 	
 	bool m_post_check = false;
 	
+	/// The stack pointer saved at the start of the body, if the body
+	/// allocates variadic arrays.
+	llvm::Value* m_stack = nullptr;
+	
+	/// The branch that enters the loop.
+	llvm::BranchInst* m_entry_branch = nullptr;
+	
+	/// Whether every range check hoisted out of the loop passed.
+	llvm::Value* m_range_ok = nullptr;
+	
+	/// Optimization hints. A value of 0 means the hint wasn't given.
+	unsigned int m_vectorize_width = 0;
+	unsigned int m_unroll_count = 0;
+	unsigned int m_interleave_count = 0;
+	bool m_assert_vectorized = false;
+	
 	ASTNode* copyIfNonNull(ASTNode* node) const;
+	
+	/// Indicates whether any variable declared directly in this loop's 
+	/// body is variadically sized.
+	bool hasVariadicDecls() const;
+	
+	/// Indicates whether any optimization hints were given to this loop.
+	bool hasHints() const;
+	
+	/// Throws a code_error at element if assert_vectorized was given with
+	/// a vectorize width of 1, which could never be checked.
+	void checkAssertVectorized(CodeBase* element) const;
+	
+	/// Creates the llvm.loop metadata describing the optimization hints 
+	/// of this loop.
+	llvm::MDNode* createLoopID() const;
 public:
 	virtual ASTNode* copy() const override;
 	
@@ -48,6 +89,50 @@ public:
 	
 	bool isPostCheck() const;
 	
+	/**
+	 * Gets the variable this loop counts with, if it counts in a way that 
+	 * the range of the variable is known before the loop starts. That's
+	 * a loop of the form for (i = start; i < end; i++), where < may also be
+	 * <=, end is a constant or a variable declared outside of the loop, and
+	 * neither i nor end are changed by the body. If the body calls a
+	 * function, end must also be a local or parameter that no other
+	 * function uses.
+	 */
+	VarDecl* getInductionVar() const;
+	
+	/**
+	 * Indicates whether stmt, one of the statements of the body, runs on
+	 * every iteration. It must be an expression or a declaration, and no
+	 * statement before it may be conditional or leave the iteration early.
+	 */
+	bool runsEveryIteration(const ASTNode* stmt) const;
+	
+	/**
+	 * Checks that every value the induction variable takes is in [0, size)
+	 * once, before the loop is entered. The check passes if the loop never 
+	 * runs. Must only be called while the body is being built, and only if
+	 * getInductionVar() isn't null. size must be an int64 available before
+	 * the loop.
+	 */
+	void addRangeCheck(llvm::Value* size);
+	
+	/// Restores the stack saved at the start of the body, freeing any
+	/// variadic arrays allocated in this iteration. Does nothing if the
+	/// stack wasn't saved.
+	void restoreStack();
+	
+	/**
+	 * Adds an optimization hint to this loop. Valid hints are 
+	 * vectorize(width), unroll(count), interleave(count), and 
+	 * assert_vectorized, which takes no value and warns after optimization
+	 * if the loop wasn't vectorized. assert_vectorized can't be combined
+	 * with vectorize(1).
+	 *
+	 * @param name The name of the hint.
+	 * @param value The value of the hint, if any.
+	 */
+	void addHint(OString name, Value* value);
+	
 	virtual bool isTerminator() const override;
 	
 	/// Checks to make sure that condition is a boolean.
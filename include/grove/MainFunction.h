@@ -16,5 +16,8 @@ protected:
 public:
 	virtual OString getMangledName() const override;
 	
+	/// The main function is called by the C runtime, so it's always exported.
+	virtual bool isExported() const override;
+	
 	MainFunction(Module* module, OString name);
 };
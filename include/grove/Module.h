@@ -8,10 +8,15 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
+#include <set>
 #include <string>
 #include <stack>
 #include <vector>
 
+#include "EmitKind.h"
+
 class Builder;
 class Namespace;
 class Block;
@@ -20,6 +25,9 @@ class ASTNode;
 
 namespace llvm { class Module; }
 namespace llvm { class LLVMContext; }
+namespace llvm { class GlobalVariable; }
+namespace llvm { class Function; }
+namespace llvm { class Constant; }
 
 namespace llvm {
 	class ConstantFolder;
@@ -41,6 +49,10 @@ llvm::IRBuilderDefaultInserter<true> > IRBuilder;
 class Module {
 private:
 	llvm::Module* m_llvm_module = nullptr;
+	
+	/// A copy of the LLVM module made before it was optimized. Only kept
+	/// when unoptimized code is to be emitted.
+	llvm::Module* m_unoptimized = nullptr;
 	IRBuilder* m_ir_builder = nullptr;
 	
 	Builder* m_builder = nullptr;
@@ -56,10 +68,34 @@ private:
 	// Stack of active blocks during parsing
 	std::stack<Block *> m_ctx;
 	
-	std::vector<ASTNode *> m_resolved;
-	std::vector<ASTNode *> m_searched;
+	std::set<ASTNode *> m_resolved;
+	std::set<ASTNode *> m_searched;
+	
+	/// String constants emitted into the LLVM module, by contents.
+	std::map<std::string, llvm::GlobalVariable *> m_strings;
+	
+	/// The records of the functions instrumented for --profile-generate.
+	std::vector<llvm::Constant *> m_profile_records;
+	
+	llvm::Function* m_profile_writer = nullptr;
 	
 	void parse();
+	
+	/// Warns about every loop that was asked to be vectorized but wasn't.
+	/// Must be called after the module has been optimized.
+	void checkVectorizedLoops() const;
+	
+	/// Gives the function that writes the profile a body, now that every
+	/// function has been instrumented.
+	void defineProfileWriter();
+	
+	/// Moves hot functions to the start of the module and cold functions to
+	/// the end, so that the code that runs most often is kept together.
+	void orderFunctions();
+	
+	/// Writes native code for an LLVM module to path, as either an object
+	/// file or assembly.
+	void emitMachineCode(llvm::Module* module, std::string path, EmitKind kind);
 public:
 	/// Gets the LLVM module.
 	llvm::Module* getLLVMModule() const;
@@ -69,9 +105,33 @@ public:
 	
 	llvm::LLVMContext& getLLVMContext() const;
 	
+	/**
+	 * Gets the null-terminated string constant with the given contents. 
+	 * Every use of the same string in this module shares one constant, 
+	 * which the linker may also merge with identical strings from other
+	 * modules.
+	 */
+	llvm::GlobalVariable* getStringConstant(std::string str);
+	
+	/// Adds the counters of an instrumented function to the records that
+	/// are written to the profile.
+	void addProfileCounters(llvm::Function* func, uint64_t hash,
+							llvm::GlobalVariable* counters);
+	
+	/// Gets the function that writes the counters of this module to the
+	/// profile. It's called by main before it returns.
+	llvm::Function* getProfileWriter();
+	
 	/// Get file that this module is building.
 	std::string getFile() const;
 	
+	/**
+	 * Gets the name of this module as used in symbol names: N, each part of
+	 * its absolute path without the extension preceded by its length, then
+	 * E. Two modules only get the same name if they're the same file.
+	 */
+	std::string getMangledName() const;
+	
 	/// Returns the builder building this module.
 	Builder* getBuilder() const;
 	
@@ -107,6 +167,9 @@ public:
 	/// Resolve unresolved nodes.
 	void resolve();
 	
+	/// Runs the function passes on an LLVM function of this module.
+	void optimizeFunction(llvm::Function* func);
+	
 	/// Generate code.
 	void build();
 	
@@ -114,6 +177,10 @@ public:
 	/// Returns the path of the object file.
 	std::string compile();
 	
+	/// Writes the module to path as a kind of file. Writes the unoptimized
+	/// code if the build settings ask for it.
+	void emit(std::string path, EmitKind kind);
+	
 	/// Constructs a new module with a specified builder and filepath.
 	Module(Builder* builder, std::string filePath);
 	
@@ -21,5 +21,9 @@ public:
 	virtual void resolve() override;
 	virtual void build() override;
 	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
 	NegativeExpr(Expression* expr);
 };
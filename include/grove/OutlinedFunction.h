@@ -0,0 +1,55 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once
+
+#include "Function.h"
+
+class Valued;
+
+/**
+ * OutlinedFunction is a function generated from code in the middle of another
+ * function, such as the body of a parallel loop. It has internal linkage.
+ *
+ * Variables and parameters of enclosing functions that the body uses are
+ * captured: their addresses are passed in through the last parameter, an
+ * int8 pointer to an array of int8 pointers, in the order given by
+ * getCaptures().
+ */
+class OutlinedFunction : public Function
+{
+private:
+	/// The captured nodes, in the order they're passed in.
+	std::vector<Valued *> m_captures;
+
+	/// The values the captured nodes had before this function was built.
+	std::vector<llvm::Value *> m_saved_values;
+
+	/// Finds the variables and parameters from outside of this function
+	/// that are used in its body.
+	void findCaptures();
+protected:
+	virtual void createFunction() override;
+
+	/// Sets up the function and points the captured nodes at the addresses
+	/// passed in, until the function is built.
+	virtual void setupFunction() override;
+public:
+	/// Gets the captured nodes. Only valid once this function has been built.
+	std::vector<Valued *> getCaptures() const;
+
+	/// An outlined function uses the fast-math setting of the function it
+	/// was taken from.
+	virtual bool isFastMath() const override;
+
+	virtual ASTNode* copy() const override;
+
+	virtual void build() override;
+
+	OutlinedFunction(OString name, std::vector<Parameter *> params);
+};
@@ -0,0 +1,60 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once
+
+#include "Block.h"
+#include "OString.h"
+
+class Expression;
+class BinOpCompare;
+class Loop;
+class OutlinedFunction;
+class Value;
+class VarDecl;
+
+/**
+ * ParallelLoop is a for loop whose iterations run in parallel on the thread
+ * pool of the libor runtime. The body is outlined into a function that runs
+ * a chunk of iterations, and the loop becomes a call to orange_parallel_for.
+ *
+ * Only loops of the form for (i = begin; i < end; i++) can run in parallel;
+ * <= and ++i are accepted as well. The body can't return or break out of
+ * the loop.
+ */
+class ParallelLoop : public Block
+{
+private:
+	VarDecl* m_decl = nullptr;
+	BinOpCompare* m_condition = nullptr;
+	Expression* m_afterthought = nullptr;
+
+	/// The outlined function that runs a chunk of iterations.
+	OutlinedFunction* m_function = nullptr;
+
+	/// The loop in m_function that iterates over the chunk.
+	Loop* m_body = nullptr;
+
+	ParallelLoop(std::vector<ASTNode*> initializers, Expression* condition,
+				 Expression* afterthought, Loop* body);
+public:
+	/// Gets the loop that runs a chunk of iterations. The statements of the
+	/// parallel loop belong to it.
+	Loop* getBody() const;
+
+	/// Adds an optimization hint to the loop that runs each chunk.
+	void addHint(OString name, Value* value);
+
+	virtual ASTNode* copy() const override;
+
+	virtual void resolve() override;
+	virtual void build() override;
+
+	ParallelLoop(std::vector<ASTNode*> initializers, Expression* condition,
+				 Expression* afterthought);
+};
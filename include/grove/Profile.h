@@ -0,0 +1,55 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace llvm { class Function; }
+
+/**
+ * Profile holds the counters written by a program built with
+ * --profile-generate, so that a later build can optimize for the paths
+ * the program actually took.
+ *
+ * Counters are matched to functions by mangled name and by a hash of the
+ * function's unoptimized code. A function whose code changed since the
+ * profile was taken has a different hash, and its counters are ignored.
+ */
+class Profile
+{
+private:
+	struct Record
+	{
+		uint64_t hash;
+		std::vector<uint64_t> counters;
+	};
+	
+	std::map<std::string, Record> m_records;
+	
+	uint64_t m_max_entry_count = 0;
+public:
+	/// Computes the hash of a function's code. Must be called before any
+	/// counters are added to it.
+	static uint64_t hash(llvm::Function* func);
+	
+	/// Gets the counters of a function, or nullptr if the profile has no
+	/// counters for this version of it.
+	const std::vector<uint64_t>* getCounters(std::string name,
+											 uint64_t hash) const;
+	
+	/// Gets the largest number of times any function was called.
+	uint64_t getMaxEntryCount() const;
+	
+	/// Loads a profile from a file. Throws a runtime_error if the file
+	/// can't be read.
+	Profile(std::string path);
+};
@@ -22,5 +22,7 @@ public:
 	virtual void resolve() override;
 	virtual void build() override;
 	
+	virtual bool isPure() const override;
+	
 	ReferenceExpr(Expression* expr);
 };
\ No newline at end of file
@@ -11,11 +11,26 @@
 #include "Statement.h"
 #include "Typed.h"
 
+namespace llvm { class CallInst; }
+
 class Expression;
+class Function;
 
+/**
+ * ReturnStmt returns from the function it's in. When it returns the result 
+ * of a call as is, it returns directly rather than through the exit block 
+ * of the function, leaving the call in tail position.
+ *
+ * A tail call (return tailcall foo()) must be made without growing the 
+ * stack. It's an error if that can't be guaranteed.
+ */
 class ReturnStmt : public Statement, public Typed {
 private:
 	Expression* m_expr = nullptr;
+	bool m_tail_call = false;
+	
+	/// Throws an error if call can't be made as a tail call from func.
+	void checkTailCall(Function* func, llvm::CallInst* call);
 public:
 	/// Get the expression that the return statement returns.
 	Expression* getExpression();
@@ -23,6 +38,9 @@ public:
 	/// Returns whether or not the return statement has an expression.
 	bool hasExpression();
 	
+	/// Returns whether or not the returned call must be a tail call.
+	bool isTailCall() const;
+	
 	virtual bool isTerminator() const override;
 	
 	virtual ASTNode* copy() const override;
@@ -31,4 +49,5 @@ public:
 	virtual void build() override;
 	
 	ReturnStmt(Expression* expression);
+	ReturnStmt(Expression* expression, bool tailCall);
 };
@@ -30,6 +30,10 @@ public:
 	virtual void resolve() override;
 	virtual void build() override;
 	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
 	SizeofExpr(Type* typeArg);
 	SizeofExpr(Expression* expr);
 };
\ No newline at end of file
@@ -29,5 +29,7 @@ public:
 	
 	virtual bool isConstant() const override;
 	
+	virtual bool isPure() const override;
+	
 	StrValue(std::string value);
 };
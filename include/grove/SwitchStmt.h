@@ -0,0 +1,66 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once 
+
+#include "Statement.h"
+
+#include <vector>
+
+class Block;
+class Expression;
+
+namespace llvm { class BasicBlock; }
+
+/**
+ * SwitchStmt represents a switch statement, which runs the first block whose
+ * values match an integer condition. A switch statement may end with an 
+ * else block that is run when no values match. 
+ *
+ * Switch statements are lowered to a single LLVM switch instruction, so 
+ * LLVM may dispatch to the matching block through a jump table.
+ */
+class SwitchStmt : public Statement
+{
+private:
+	Expression* m_condition = nullptr;
+	
+	std::vector<Block *> m_switch_blocks;
+	
+	llvm::BasicBlock* m_continue_block = nullptr;
+protected:
+	bool isElse(Block* block) const;
+public:
+	/// Gets the expression being switched on.
+	Expression* getCondition() const;
+	
+	/// Gets all case blocks, including the else block.
+	std::vector<Block *> getBlocks() const;
+	
+	/// Gets the continue block.
+	llvm::BasicBlock* continueBlock() const;
+	
+	/// Adds a block to the list of case blocks. The block must either be a 
+	/// CaseBlock or the final else block.
+	void addBlock(Block* block);
+	
+	/// Determines whether or not there is an else block.
+	bool hasElse() const;
+	
+	/// Returns whether or not this switch statement is a terminator.
+	/// It will only be a terminator if it has an else block and every one
+	/// of the blocks is a terminator.
+	virtual bool isTerminator() const override;
+	
+	virtual ASTNode* copy() const override;
+	
+	virtual void resolve() override;
+	virtual void build() override;
+	
+	SwitchStmt(Expression* condition);
+};
@@ -26,6 +26,10 @@ public:
 	virtual void resolve() override;
 	virtual void build() override;
 	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
 	TernaryExpr(Expression* condition, Expression* trueval,
 				Expression* falseval);
 };
\ No newline at end of file
@@ -26,6 +26,9 @@ private:
 	} m_values;
 	
 	Value();
+	
+	/// Wraps an integer value around to the width of its type.
+	void fitToType();
 public:
 	virtual void build() override;
 	
@@ -33,11 +36,16 @@ public:
 	
 	virtual bool isConstant() const override;
 	
+	virtual bool isPure() const override;
+	
+	virtual Value* fold() const override;
+	
 	int64_t getInt() const;
 	uint64_t getUInt() const;
 	double getDouble() const;
 	
-	/// Converts to a new type.
+	/// Converts to a new integer, floating point, or boolean type, the same
+	/// way a cast would at run time.
 	void convert(Type* newty);
 	
 	/// Gets a new value from this value with the added
@@ -48,6 +56,15 @@ public:
 	/// Throws an error if this is unsigned.
 	void negate();
 	
+	/// Creates a value of type t from a signed integer.
+	static Value* fromInt(int64_t i, Type* t);
+	
+	/// Creates a value of type t from an unsigned integer.
+	static Value* fromUInt(uint64_t u, Type* t);
+	
+	/// Creates a value of type t from a floating point number.
+	static Value* fromDouble(double d, Type* t);
+	
 	Value(char c);
 	
 	/**
@@ -29,6 +29,10 @@ public:
 	/// True in the case of pointers.
 	virtual bool hasPointer() const;
 	
+	/// Gets the alignment in bytes of the memory that getPointer points to,
+	/// if it was given one. Returns 0 if only the type's alignment is known.
+	virtual unsigned int getAlignment() const;
+	
 	/// If this value was allocated with an array size,
 	/// returns that size.
 	virtual llvm::Value* getSize() const;
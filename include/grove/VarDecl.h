@@ -14,6 +14,7 @@
 #include "Valued.h"
 
 class Expression;
+class Value;
 
 /**
  * VarDecl is a statement that represents a variable declaration. 
@@ -23,10 +24,25 @@ class VarDecl : public Statement, public Named, public Typed, public Valued
 {
 private:
 	Expression* m_expr = nullptr;
+	
+	/// The alignment requested for this variable, or 0 for the alignment
+	/// of its type.
+	unsigned int m_alignment = 0;
+	
+	/// Indicates whether this variable may be written to after it's 
+	/// declared. See Function::isWritten.
+	bool isWritten() const;
 public:
 	virtual llvm::Value* getValue() const override;
 	virtual llvm::Value* getPointer() const override;
 	virtual bool hasPointer() const override;
+	virtual unsigned int getAlignment() const override;
+	
+	/**
+	 * Sets the alignment of this variable in bytes. Throws a code_error if 
+	 * value isn't a power of two. The value isn't owned by the declaration.
+	 */
+	void setAlignment(Value* value);
 	
 	virtual ASTNode* copy() const override;
 	
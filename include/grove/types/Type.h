@@ -18,6 +18,7 @@
 
 class Module;
 class Expression;
+class CodeBase;
 
 namespace llvm { class Type; }
 namespace llvm { class LLVMContext; }
@@ -114,6 +115,7 @@ public:
 	virtual bool isPointerTy() const;
 	virtual bool isVoidTy() const;
 	virtual bool isVarTy() const;
+	virtual bool isVectorTy() const;
 	
 	virtual unsigned int getIntegerBitWidth() const;
 
@@ -142,6 +144,11 @@ public:
 	
 	virtual std::vector<Expression*> getVariadicSizes() const;
 	
+	/// Gets the fixed-size array type this type is equivalent to, if every
+	/// variadic size of it can be folded to a constant. Returns this type
+	/// otherwise. The sizes must already be resolved.
+	Type* getFoldedTy() const;
+	
 	/// Gets whether or not this type matches another type.
 	/// Returns true if either of the types are VarType.
 	bool matches(Type* ty) const;
@@ -157,7 +164,10 @@ public:
 	static bool exprValidForArrSize(Expression* expr);
 	static unsigned int exprAsArrSize(Expression* expr);
 	
-	int castOperation(Type* to);
+	/// Gets the operation that casts to another type. element is the value
+	/// being cast, which errors about the cast point to; it's needed when
+	/// casting to a vector.
+	int castOperation(Type* to, CodeBase* element = nullptr);
 	llvm::Value* cast(void *irBuilder, Valued* val, Type* target);
 
 	virtual ~Type();
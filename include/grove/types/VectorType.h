@@ -0,0 +1,67 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once
+
+#include "Type.h"
+
+class Valued;
+class CodeBase;
+
+/**
+ * VectorType is a fixed number of integers, floating point numbers, or
+ * booleans that are operated on together, like float32x4 or uint8x16.
+ * Arithmetic and comparisons work on each lane, and a scalar used with a
+ * vector is copied to every lane.
+ */
+class VectorType : public Type
+{
+private:
+	Type* m_contained = nullptr;
+	unsigned int m_size = 0;
+protected:
+	VectorType(Type* contained, unsigned int size, bool isConst);
+public:
+	static std::string getSignature(Type* contained, unsigned int size,
+									bool isConst);
+	virtual std::string getString() const override;
+	virtual std::string getSignature() const override;
+	
+	/// Gets the number of lanes in the vector.
+	unsigned int getSize() const;
+	
+	virtual bool isSigned() const override;
+	
+	virtual bool isVectorTy() const override;
+	
+	virtual Type* getBaseTy() const override;
+	
+	virtual Type* getRootTy() const override;
+	
+	virtual Type* getConst() const override;
+	
+	/**
+	 * Gets the cast operation that converts each lane of from to the lanes
+	 * of to. from may be a scalar, an array, or a vector with as many lanes
+	 * as to. Throws a code_error pointing at element, the value being cast,
+	 * if the lanes don't match.
+	 */
+	static int getCastOperation(Type* from, VectorType* to,
+								CodeBase* element);
+	
+	/// Casts val, of type from, to a vector. A scalar is copied to every
+	/// lane, and each element of an array is put in its own lane.
+	static llvm::Value* createCast(void* irBuilder, Valued* val, Type* from,
+								   VectorType* to);
+	
+	/// Gets a vector type from its name, such as int32x4 or floatx8.
+	static VectorType* getNamed(std::string name);
+	
+	static VectorType* get(Type* contained, unsigned int size,
+						   bool isConst = false);
+};
@@ -0,0 +1,37 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The body of a parallel loop. Runs the iterations in [lo, hi).
+typedef void (*orange_parallel_body)(int64_t lo, int64_t hi, void* ctx);
+
+/**
+ * Runs body over the iterations in [begin, end) on the runtime's thread pool.
+ * The range is split into chunks that are spread over the workers; idle
+ * workers steal chunks from busy ones. Returns once every iteration has run.
+ *
+ * Calls made from inside a parallel body run serially on the calling thread.
+ *
+ * @param begin The first iteration.
+ * @param end One past the last iteration.
+ * @param body The function to run on each chunk.
+ * @param ctx The context passed to each call of body.
+ */
+void orange_parallel_for(int64_t begin, int64_t end, orange_parallel_body body,
+                         void* ctx);
+
+#ifdef __cplusplus
+}
+#endif
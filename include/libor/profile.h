@@ -0,0 +1,44 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The counters of a function built with --profile-generate. Counter 0 is
+/// the number of times the function was called; the rest count how often
+/// each of its conditional branches ran and was taken.
+struct orange_profile_record
+{
+	const char* name;
+	uint64_t hash;
+	uint64_t num_counters;
+	uint64_t* counters;
+};
+
+/**
+ * Writes the counters of an instrumented program to its profile. The
+ * profile is written to the file named by the ORANGE_PROFILE_FILE
+ * environment variable, or default.orprof in the working directory.
+ *
+ * Each line of the profile is the name of a function, its hash, the number
+ * of counters, and then the counters, separated by spaces.
+ *
+ * @param records The records of every instrumented function.
+ * @param count The number of records.
+ */
+void orange_profile_write(const struct orange_profile_record* records,
+                          uint64_t count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -17,6 +17,15 @@ class BuildCommand : public OptionsState
 {
 private:
 	std::shared_ptr<StateFlag> m_output;
+	std::shared_ptr<StateFlag> m_stats;
+	std::shared_ptr<StateFlag> m_share_instances;
+	std::shared_ptr<StateFlag> m_bounds_check;
+	std::shared_ptr<StateFlag> m_inline_threshold;
+	std::shared_ptr<StateFlag> m_profile_generate;
+	std::shared_ptr<StateFlag> m_profile_use;
+	std::shared_ptr<StateFlag> m_fast_math;
+	std::shared_ptr<StateFlag> m_emit;
+	std::shared_ptr<StateFlag> m_pre_opt;
 public:
 	virtual int run(std::vector<std::string> args) override;
 	
@@ -15,6 +15,13 @@
  */
 class RunCommand : public OptionsState
 {
+private:
+	std::shared_ptr<StateFlag> m_stats;
+	std::shared_ptr<StateFlag> m_bounds_check;
+	std::shared_ptr<StateFlag> m_inline_threshold;
+	std::shared_ptr<StateFlag> m_profile_generate;
+	std::shared_ptr<StateFlag> m_profile_use;
+	std::shared_ptr<StateFlag> m_fast_math;
 public:
 	virtual int run(std::vector<std::string> args) override;
 
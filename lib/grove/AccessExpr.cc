@@ -7,6 +7,7 @@
 */
 
 #include <grove/AccessExpr.h>
+#include <grove/Value.h>
 
 #include <grove/exceptions/fatal_error.h>
 
@@ -65,6 +66,17 @@ Expression* AccessExpr::access(OString name, Type* hint) const
 	return getAccessed()->ASTNode::as<Accessible *>()->access(name, hint);
 }
 
+bool AccessExpr::isPure() const
+{
+	return getLHS()->isPure() && getAccessed()->isPure();
+}
+
+Value* AccessExpr::fold() const
+{
+	// Members of enums are values.
+	return getAccessed()->fold();
+}
+
 AccessExpr::AccessExpr(Expression* LHS, OString name)
 {
 	if (name == "")
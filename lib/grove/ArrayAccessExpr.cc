@@ -7,16 +7,30 @@
 */
 
 #include <grove/ArrayAccessExpr.h>
+#include <grove/BinOpAndOr.h>
+#include <grove/Builder.h>
+#include <grove/BuildSettings.h>
+#include <grove/Function.h>
+#include <grove/IDReference.h>
+#include <grove/Loop.h>
 #include <grove/Module.h>
+#include <grove/TernaryExpr.h>
+#include <grove/Value.h>
+#include <grove/VarDecl.h>
 
 #include <grove/exceptions/invalid_type_error.h>
 
 #include <grove/types/Type.h>
+#include <grove/types/VectorType.h>
 
 #include <util/assertions.h>
 
+#include <algorithm>
+
 #include <llvm/IR/Constants.h>
+#include <llvm/IR/DataLayout.h>
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/Support/MathExtras.h>
 
 ASTNode* ArrayAccessExpr::copy() const
 {
@@ -35,12 +49,142 @@ Expression* ArrayAccessExpr::getIndex() const
 	return m_idx;
 }
 
+llvm::Value* ArrayAccessExpr::getElementCount() const
+{
+	auto array_ty = getArray()->getType();
+	if (array_ty->isVectorTy())
+	{
+		return IRBuilder()->getInt64(array_ty->as<VectorType *>()->getSize());
+	}
+	
+	if (array_ty->isArrayTy() == false)
+	{
+		return nullptr;
+	}
+	
+	if (array_ty->isVariadiclySized() == false)
+	{
+		auto llvm_ty = llvm::cast<llvm::ArrayType>(array_ty->getLLVMType());
+		return IRBuilder()->getInt64(llvm_ty->getNumElements());
+	}
+	
+	// The size of a variadic array is the product of all of its variadic 
+	// dimensions, so it's only the number of elements if there's one.
+	if (array_ty->getBaseTy()->isVariadiclySized() ||
+		array_ty->getVariadicSizes().size() != 1)
+	{
+		return nullptr;
+	}
+	
+	return getArray()->getSize();
+}
+
+Loop* ArrayAccessExpr::findCountingLoop() const
+{
+	if (getIndex()->ASTNode::is<IDReference *>() == false)
+	{
+		return nullptr;
+	}
+	
+	auto counter = getIndex()->ASTNode::as<IDReference *>()->getNode();
+	
+	// The size of a variadic array declared in the loop isn't known before
+	// the loop.
+	VarDecl* array_decl = nullptr;
+	if (getArray()->getType()->isVariadiclySized() &&
+		getArray()->ASTNode::is<IDReference *>() &&
+		getArray()->ASTNode::as<IDReference *>()->getNode()->is<VarDecl *>())
+	{
+		array_decl = getArray()->ASTNode::as<IDReference *>()->getNode()
+			->as<VarDecl *>();
+	}
+	
+	// Whether this access only runs when some other expression says so.
+	bool conditional = false;
+	
+	const ASTNode* child = this;
+	for (auto parent = getParent(); parent != nullptr &&
+		 parent->is<Function *>() == false; parent = parent->getParent())
+	{
+		if (array_decl != nullptr && parent == array_decl->getParent())
+		{
+			return nullptr;
+		}
+		
+		if (parent->is<BinOpAndOr *>() &&
+			parent->as<BinOpAndOr *>()->getRHS() == child)
+		{
+			conditional = true;
+		}
+		
+		if (parent->is<TernaryExpr *>() &&
+			parent->as<TernaryExpr *>()->getCondition() != child)
+		{
+			conditional = true;
+		}
+		
+		// Only the body runs with the counter in range, and the check
+		// before the loop may only fail if this access would have.
+		if (parent->is<Loop *>())
+		{
+			auto loop = parent->as<Loop *>();
+			auto stmts = loop->getStatements();
+			
+			if (std::find(stmts.begin(), stmts.end(), child) != stmts.end() &&
+				loop->getInductionVar() == counter)
+			{
+				if (conditional || loop->runsEveryIteration(child) == false)
+				{
+					return nullptr;
+				}
+				
+				return loop;
+			}
+		}
+		
+		child = parent;
+	}
+	
+	return nullptr;
+}
+
+void ArrayAccessExpr::checkBounds(llvm::Value* vIndex)
+{
+	auto size = getElementCount();
+	if (size == nullptr)
+	{
+		return;
+	}
+	
+	auto loop = findCountingLoop();
+	if (loop != nullptr)
+	{
+		loop->addRangeCheck(size);
+		return;
+	}
+	
+	auto func = findParent<Function *>();
+	
+	auto idx = IRBuilder()->CreateIntCast(vIndex, IRBuilder()->getInt64Ty(),
+										  getIndex()->getType()->isSigned());
+	
+	// A negative index is larger than any size when compared unsigned.
+	auto in_bounds = IRBuilder()->CreateICmpULT(idx, size);
+	
+	auto ok = llvm::BasicBlock::Create(getModule()->getLLVMContext(),
+									   "inbounds", func->getLLVMFunction(),
+									   func->getExit());
+	IRBuilder()->CreateCondBr(in_bounds, ok, func->getTrapBlock());
+	IRBuilder()->SetInsertPoint(ok);
+}
+
 void ArrayAccessExpr::resolve()
 {
 	auto array_ty = getArray()->getType();
 	assertExists(array_ty, "Array has no type");
 	
-	bool valid = array_ty->isArrayTy() || array_ty->isPointerTy();
+	bool valid = array_ty->isArrayTy() || array_ty->isPointerTy() ||
+		array_ty->isVectorTy();
 	if (valid == false)
 	{
 		throw invalid_type_error(this, "cannot access element of non-array type",
@@ -59,19 +203,71 @@ void ArrayAccessExpr::resolve()
 	setType(array_ty->getBaseTy());
 }
 
+unsigned int ArrayAccessExpr::findAlignment() const
+{
+	// Only the memory of an array itself is aligned, not the memory a 
+	// pointer points to.
+	auto array_align = getArray()->getAlignment();
+	if (array_align == 0 || getArray()->getType()->isArrayTy() == false ||
+		getArray()->hasPointer() == false)
+	{
+		return 0;
+	}
+	
+	auto layout = getModule()->getLLVMModule()->getDataLayout();
+	uint64_t offset = layout->getTypeAllocSize(getType()->getLLVMType());
+	
+	// A constant index gives the exact offset; otherwise, the element is 
+	// at some multiple of its size.
+	auto idx = getIndex()->fold();
+	if (idx != nullptr)
+	{
+		offset *= idx->getUInt();
+		delete idx;
+	}
+	
+	return (unsigned int)llvm::MinAlign(array_align, offset);
+}
+
 bool ArrayAccessExpr::hasPointer() const
 {
-	return true;
+	// A lane of a vector that isn't stored anywhere can only be read, and
+	// so can a lane of a bool vector, whose lanes are bits rather than bytes.
+	auto array_ty = getArray()->getType();
+	if (array_ty->isVectorTy() == false)
+	{
+		return true;
+	}
+	
+	return getArray()->hasPointer() &&
+		array_ty->getBaseTy()->isBoolTy() == false;
+}
+
+unsigned int ArrayAccessExpr::getAlignment() const
+{
+	return m_alignment;
 }
 
 llvm::Value* ArrayAccessExpr::getPointer() const
 {
-	return m_value;
+	return hasPointer() ? m_value : nullptr;
 }
 
 llvm::Value* ArrayAccessExpr::getValue() const
 {
-	return IRBuilder()->CreateLoad(m_value);
+	if (hasPointer() == false)
+	{
+		return m_value;
+	}
+	
+	auto load = IRBuilder()->CreateLoad(m_value);
+	
+	if (m_alignment != 0)
+	{
+		load->setAlignment(m_alignment);
+	}
+	
+	return load;
 }
 
 void ArrayAccessExpr::build()
@@ -79,8 +275,11 @@ void ArrayAccessExpr::build()
 	getArray()->build();
 	getIndex()->build();
 	
+	auto array_ty = getArray()->getType();
+	
 	llvm::Value* vArray = nullptr;
-	if (getArray()->hasPointer() && getArray()->getType()->isArrayTy())
+	if (getArray()->hasPointer() && (array_ty->isArrayTy() ||
+		(array_ty->isVectorTy() && hasPointer())))
 	{
 		vArray = getArray()->getPointer();
 	}
@@ -94,10 +293,21 @@ void ArrayAccessExpr::build()
 	assertExists(vArray, "Array generated no value");
 	assertExists(vIndex, "Index generated no value");
 	
+	if (getModule()->getBuilder()->getSettings()->getBoundsCheck())
+	{
+		checkBounds(vIndex);
+	}
+	
+	if (hasPointer() == false)
+	{
+		setValue(IRBuilder()->CreateExtractElement(vArray, vIndex));
+		return;
+	}
+	
 	std::vector<llvm::Value *> indices;
 	
-	if (getArray()->getType()->isArrayTy() &&
-		getArray()->getType()->isVariadiclySized() == false)
+	if ((array_ty->isArrayTy() && array_ty->isVariadiclySized() == false) ||
+		array_ty->isVectorTy())
 	{
 		auto& ctx = getModule()->getLLVMContext();
 		auto idx = llvm::ConstantInt::get(llvm::Type::getInt64Ty(ctx), 0);
@@ -106,6 +316,7 @@ void ArrayAccessExpr::build()
 	
 	indices.push_back(vIndex);
 	
+	m_alignment = findAlignment();
 	setValue(IRBuilder()->CreateInBoundsGEP(vArray, indices));
 }
 
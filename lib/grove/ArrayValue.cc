@@ -7,6 +7,9 @@
 */
 
 #include <grove/ArrayValue.h>
+#include <grove/Function.h>
+#include <grove/Module.h>
+#include <grove/VarDecl.h>
 
 #include <grove/types/Type.h>
 #include <grove/types/ArrayType.h>
@@ -20,6 +23,8 @@
 
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/Constants.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/Module.h>
 
 ASTNode* ArrayValue::copy() const
 {
@@ -65,6 +70,33 @@ void ArrayValue::resolve()
 	setType(ArrayType::get(highest, getElements().size()));
 }
 
+llvm::GlobalVariable* ArrayValue::createGlobal()
+{
+	std::vector<llvm::Constant *> consts;
+	
+	for (auto element : getElements())
+	{
+		auto ele = element->castTo(getType()->getBaseTy());
+		assertExists(ele, "Element couldn't be casted");
+		
+		if (llvm::isa<llvm::Constant>(ele) == false)
+		{
+			throw fatal_error("element was not a constant");
+		}
+		
+		consts.push_back((llvm::Constant *)ele);
+	}
+	
+	auto array_ty = (llvm::ArrayType *)getType()->getLLVMType();
+	auto init = llvm::ConstantArray::get(array_ty, consts);
+	
+	auto global = new llvm::GlobalVariable(*getModule()->getLLVMModule(),
+		array_ty, true, llvm::GlobalValue::PrivateLinkage, init, "array");
+	global->setUnnamedAddr(true);
+	
+	return global;
+}
+
 void ArrayValue::build()
 {
 	// Build all elements
@@ -73,28 +105,24 @@ void ArrayValue::build()
 		element->build();
 	}
 	
-	auto val = IRBuilder()->CreateAlloca(getType()->getLLVMType());
-	
 	if (isConstant())
 	{
-		std::vector<llvm::Constant *> consts;
+		m_global = createGlobal();
 		
-		for (auto element : getElements())
+		if (getParent()->is<VarDecl *>())
 		{
-			auto ele = element->castTo(getType()->getBaseTy());
-			assertExists(ele, "Element couldn't be casted");
-			
-			if (llvm::isa<llvm::Constant>(ele) == false)
-			{
-				throw fatal_error("element was not a constant");
-			}
-				
-			consts.push_back((llvm::Constant *)ele);
+			setValue(m_global);
+			return;
 		}
-		
-		auto array_ty = (llvm::ArrayType *)getType()->getLLVMType();
-		auto store = llvm::ConstantArray::get(array_ty, consts);
-		IRBuilder()->CreateStore(store, val);
+	}
+	
+	auto func = findParent<Function *>();
+	auto val = func->createSlot(getType()->getLLVMType());
+	
+	if (isConstant())
+	{
+		auto size = llvm::ConstantExpr::getSizeOf(getType()->getLLVMType());
+		IRBuilder()->CreateMemCpy(val, m_global, size, 0);
 	}
 	else
 	{
@@ -129,6 +157,11 @@ llvm::Value* ArrayValue::getValue() const
 	return IRBuilder()->CreateLoad(m_value);
 }
 
+llvm::GlobalVariable* ArrayValue::getGlobal() const
+{
+	return m_global;
+}
+
 bool ArrayValue::isConstant() const
 {
 	for (auto element : getElements())
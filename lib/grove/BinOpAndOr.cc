@@ -49,35 +49,58 @@ void BinOpAndOr::resolve()
 
 void BinOpAndOr::build()
 {
-	auto parent_func = findParent<Function *>();
-	auto llvm_func = parent_func->getLLVMFunction();
 	auto bool_ty = getLHS()->getType();
 	auto const_true = llvm::ConstantInt::get(bool_ty->getLLVMType(), 1);
 	
-	auto check_rhs = llvm::BasicBlock::Create(getModule()->getLLVMContext(),
-		"check_rhs", llvm_func, parent_func->getExit());
-	auto cont = llvm::BasicBlock::Create(getModule()->getLLVMContext(),
-		"continue", llvm_func, parent_func->getExit());
-	
 	// Generate LHS
 	getLHS()->build();
 	
 	auto vLHS = getLHS()->getValue();
 	assertExists(vLHS, "LHS didn't generate a value!");
 	
-	auto ptr = IRBuilder()->CreateAlloca(bool_ty->getLLVMType());
-	auto val = IRBuilder()->CreateICmpEQ(vLHS, const_true);
-	IRBuilder()->CreateStore(val, ptr);
+	auto lhs = IRBuilder()->CreateICmpEQ(vLHS, const_true);
+	
+	// If the RHS is cheap and has no side effects, there's no need to
+	// short circuit; evaluate it unconditionally.
+	if (getRHS()->isCheap())
+	{
+		getRHS()->build();
+		
+		auto vRHS = getRHS()->getValue();
+		assertExists(vRHS, "RHS didn't generate a value!");
+		auto rhs = IRBuilder()->CreateICmpEQ(vRHS, const_true);
+		
+		if (getOperator() == "&&")
+		{
+			setValue(IRBuilder()->CreateAnd(lhs, rhs));
+		}
+		else
+		{
+			setValue(IRBuilder()->CreateOr(lhs, rhs));
+		}
+		
+		return;
+	}
+	
+	auto parent_func = findParent<Function *>();
+	auto llvm_func = parent_func->getLLVMFunction();
+	
+	auto check_rhs = llvm::BasicBlock::Create(getModule()->getLLVMContext(),
+		"check_rhs", llvm_func, parent_func->getExit());
+	auto cont = llvm::BasicBlock::Create(getModule()->getLLVMContext(),
+		"continue", llvm_func, parent_func->getExit());
+	
+	auto lhs_end = IRBuilder()->GetInsertBlock();
 	
 	if (getOperator() == "&&")
 	{
 		// If LHS was true, we need to check RHS, too.
-    	IRBuilder()->CreateCondBr(val, check_rhs, cont);
+    	IRBuilder()->CreateCondBr(lhs, check_rhs, cont);
 	}
 	else if (getOperator() == "||")
 	{
 		// If LHS was true, we don't need to check LHS.
-    	IRBuilder()->CreateCondBr(val, cont, check_rhs);
+    	IRBuilder()->CreateCondBr(lhs, cont, check_rhs);
 	}
 
 	// Generate RHS.
@@ -87,13 +110,23 @@ void BinOpAndOr::build()
 	
 	auto vRHS = getRHS()->getValue();
 	assertExists(vRHS, "RHS didn't generate a value!");
-	val = IRBuilder()->CreateICmpEQ(vRHS, const_true);
-	IRBuilder()->CreateStore(val, ptr);
+	auto rhs = IRBuilder()->CreateICmpEQ(vRHS, const_true);
+	auto rhs_end = IRBuilder()->GetInsertBlock();
 	IRBuilder()->CreateBr(cont);
 	
-	// Get value of expression
+	// Get value of expression. Coming from the LHS block means the LHS
+	// decided the result on its own.
 	IRBuilder()->SetInsertPoint(cont);
-	setValue(IRBuilder()->CreateLoad(ptr));
+	
+	auto phi = IRBuilder()->CreatePHI(lhs->getType(), 2);
+	phi->addIncoming(lhs, lhs_end);
+	phi->addIncoming(rhs, rhs_end);
+	setValue(phi);
+}
+
+bool BinOpAndOr::isPure() const
+{
+	return getLHS()->isPure() && getRHS()->isPure();
 }
 
 BinOpAndOr::BinOpAndOr(Expression* LHS, OString op, Expression* RHS)
@@ -7,6 +7,7 @@
 */
 
 #include <grove/BinOpArith.h>
+#include <grove/Value.h>
 #include <grove/types/Type.h>
 
 #include <grove/exceptions/fatal_error.h>
@@ -18,6 +19,8 @@
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/InstrTypes.h>
 
+#include <cmath>
+#include <cstdint>
 #include <map>
 #include <tuple>
 
@@ -139,6 +142,148 @@ void BinOpArith::build()
 	setValue(value);
 }
 
+bool BinOpArith::isPure() const
+{
+	// Division and remainder may trap when dividing by zero.
+	if (getOperator() == "/" || getOperator() == "%")
+	{
+		return false;
+	}
+	
+	return getLHS()->isPure() && getRHS()->isPure();
+}
+
+Value* BinOpArith::fold() const
+{
+	auto lhs = getLHS()->fold();
+	auto rhs = getRHS()->fold();
+	
+	auto result = compute(lhs, rhs);
+	
+	delete lhs;
+	delete rhs;
+	
+	return result;
+}
+
+Value* BinOpArith::compute(Value* lhs, Value* rhs) const
+{
+	if (convertOperands(lhs, rhs) == false)
+	{
+		return nullptr;
+	}
+	
+	return compute(getOperator(), lhs, rhs, getType(), areOperandsSigned());
+}
+
+Value* BinOpArith::compute(OString op, const Value* lhs, const Value* rhs,
+						   Type* ty, bool isSigned)
+{
+	if (ty->isIntTy() == false && ty->isFloatingPointTy() == false)
+	{
+		return nullptr;
+	}
+	
+	Value* result = nullptr;
+	
+	if (ty->isFloatingPointTy())
+	{
+		auto a = lhs->getDouble();
+		auto b = rhs->getDouble();
+		
+		if (op == "+")
+		{
+			result = Value::fromDouble(a + b, ty);
+		}
+		else if (op == "-")
+		{
+			result = Value::fromDouble(a - b, ty);
+		}
+		else if (op == "*")
+		{
+			result = Value::fromDouble(a * b, ty);
+		}
+		else if (op == "/")
+		{
+			result = Value::fromDouble(a / b, ty);
+		}
+		else if (op == "%")
+		{
+			result = Value::fromDouble(std::fmod(a, b), ty);
+		}
+	}
+	else if (op == "/" && rhs->getUInt() == 0)
+	{
+		// Dividing by zero traps at run time, so leave it there.
+	}
+	else if (op == "/" && isSigned)
+	{
+		auto a = lhs->getInt();
+		auto b = rhs->getInt();
+		
+		if (a != INT64_MIN || b != -1)
+		{
+			result = Value::fromInt(a / b, ty);
+			
+			// The quotient overflows if it doesn't fit in the type.
+			if (result->getInt() != a / b)
+			{
+				delete result;
+				result = nullptr;
+			}
+		}
+	}
+	else
+	{
+		// Wrapping arithmetic is the same for signed and unsigned integers,
+		// and the result is wrapped to the width of the type.
+		auto a = lhs->getUInt();
+		auto b = rhs->getUInt();
+		
+		if (op == "+")
+		{
+			result = Value::fromUInt(a + b, ty);
+		}
+		else if (op == "-")
+		{
+			result = Value::fromUInt(a - b, ty);
+		}
+		else if (op == "*")
+		{
+			result = Value::fromUInt(a * b, ty);
+		}
+		else if (op == "/")
+		{
+			result = Value::fromUInt(a / b, ty);
+		}
+		else if (op == "|")
+		{
+			result = Value::fromUInt(a | b, ty);
+		}
+		else if (op == "&")
+		{
+			result = Value::fromUInt(a & b, ty);
+		}
+		else if (op == "^")
+		{
+			result = Value::fromUInt(a ^ b, ty);
+		}
+		else if (op == "%")
+		{
+			// % is always an unsigned remainder of the bits in the type.
+			auto width = ty->getIntegerBitWidth();
+			auto mask = width >= 64 ? UINT64_MAX : (UINT64_C(1) << width) - 1;
+			
+			if ((b & mask) != 0)
+			{
+				result = Value::fromUInt((a & mask) % (b & mask), ty);
+			}
+		}
+	}
+	
+	return result;
+}
+
 BinOpArith::BinOpArith(Expression* LHS, OString op, Expression* RHS)
 : BinOpExpr(LHS, op, RHS)
 {
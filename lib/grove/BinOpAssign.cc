@@ -7,6 +7,8 @@
 */
 
 #include <grove/BinOpAssign.h>
+#include <grove/BinOpArith.h>
+#include <grove/Value.h>
 
 #include <grove/exceptions/fatal_error.h>
 #include <grove/exceptions/binop_error.h>
@@ -19,6 +21,7 @@
 
 #include <llvm/IR/IRBuilder.h>
 
+#include <cstdint>
 #include <map>
 #include <tuple>
 
@@ -81,6 +84,54 @@ OString BinOpAssign::getArithOp() const
 	return getOperator().str().substr(0, 1);
 }
 
+Value* BinOpAssign::compute(Value* current, Value* rhs) const
+{
+	auto ty = getLHS()->getType();
+	
+	auto isScalar = [](Type* ty) -> bool
+	{
+		return ty->isIntTy() || ty->isFloatingPointTy() || ty->isBoolTy();
+	};
+	
+	if (rhs == nullptr || isScalar(ty) == false ||
+		isScalar(rhs->getType()) == false)
+	{
+		return nullptr;
+	}
+	
+	rhs->convert(ty);
+	
+	if (doesArithmetic() == false)
+	{
+		return rhs->fold();
+	}
+	
+	if (current == nullptr)
+	{
+		return nullptr;
+	}
+	
+	// Unlike %, %= is a signed remainder for signed operands.
+	if (getArithOp() == "%" && ty->isIntTy() && areOperandsSigned())
+	{
+		auto a = current->getInt();
+		auto b = rhs->getInt();
+		
+		auto width = ty->getIntegerBitWidth();
+		auto min = width >= 64 ? INT64_MIN : -((int64_t)1 << (width - 1));
+		
+		if (b == 0 || (a == min && b == -1))
+		{
+			return nullptr;
+		}
+		
+		return Value::fromInt(a % b, ty);
+	}
+	
+	return BinOpArith::compute(getArithOp(), current, rhs, ty,
+							   areOperandsSigned());
+}
+
 ASTNode* BinOpAssign::copy() const
 {
 	auto copiedLHS = getLHS()->copy()->as<Expression *>();
@@ -104,6 +155,14 @@ void BinOpAssign::resolve()
 	assertExists(getLHS()->getType(), "LHS doesn't have a type");
 	setType(getLHS()->getType());
 	
+	// A vector can't be stored in a single variable.
+	if (getRHS()->getType()->isVectorTy() &&
+		getLHS()->getType()->isVectorTy() == false)
+	{
+		throw binop_error(this, getLHS()->getType(), getOperator(),
+						  getRHS()->getType());
+	}
+	
 	if (getLHS()->getType()->isConst())
 	{
 		throw code_error(getLHS(), []() -> std::string
@@ -172,7 +231,12 @@ void BinOpAssign::build()
 	assertExists(ptr, "LHS didn't give a pointer");
 	
 	assertEqual<VAL, PTR>(val, ptr, "Can't assign RHS to address");
-	IRBuilder()->CreateStore(val, ptr);
+	auto store = IRBuilder()->CreateStore(val, ptr);
+	
+	if (getLHS()->getAlignment() != 0)
+	{
+		store->setAlignment(getLHS()->getAlignment());
+	}
 	
 	setValue(vRHS);
 }
@@ -7,8 +7,10 @@
 */
 
 #include <grove/BinOpCompare.h>
+#include <grove/Value.h>
 
 #include <grove/types/BoolType.h>
+#include <grove/types/VectorType.h>
 
 #include <grove/exceptions/fatal_error.h>
 #include <grove/exceptions/binop_error.h>
@@ -19,6 +21,7 @@
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/InstrTypes.h>
 
+#include <cmath>
 #include <map>
 #include <tuple>
 
@@ -70,7 +73,17 @@ ASTNode* BinOpCompare::copy() const
 void BinOpCompare::resolve()
 {
 	BinOpExpr::resolve();
-	setType(BoolType::get());
+	
+	// Vectors are compared lane by lane.
+	if (getVectorTy() != nullptr)
+	{
+		auto size = getVectorTy()->as<VectorType *>()->getSize();
+		setType(VectorType::get(BoolType::get(), size));
+	}
+	else
+	{
+		setType(BoolType::get());
+	}
 }
 
 void BinOpCompare::build()
@@ -124,6 +137,91 @@ void BinOpCompare::build()
 	setValue(value);
 }
 
+bool BinOpCompare::isPure() const
+{
+	return getLHS()->isPure() && getRHS()->isPure();
+}
+
+Value* BinOpCompare::fold() const
+{
+	auto lhs = getLHS()->fold();
+	auto rhs = getRHS()->fold();
+	
+	auto result = compute(lhs, rhs);
+	
+	delete lhs;
+	delete rhs;
+	
+	return result;
+}
+
+Value* BinOpCompare::compute(Value* lhs, Value* rhs) const
+{
+	if (convertOperands(lhs, rhs) == false)
+	{
+		return nullptr;
+	}
+	
+	// Gets the result of the comparison given the ordering of the operands.
+	auto result = [this](bool less, bool equal) -> bool
+	{
+		auto op = getOperator();
+		
+		if (op == "<")
+		{
+			return less;
+		}
+		else if (op == ">")
+		{
+			return less == false && equal == false;
+		}
+		else if (op == "<=")
+		{
+			return less || equal;
+		}
+		else if (op == ">=")
+		{
+			return less == false;
+		}
+		else if (op == "==")
+		{
+			return equal;
+		}
+		
+		return equal == false;
+	};
+	
+	bool cmp = false;
+	
+	if (isFloatingPointOperation())
+	{
+		auto a = lhs->getDouble();
+		auto b = rhs->getDouble();
+		
+		// Comparisons are ordered, so they're all false with NaN.
+		if (std::isnan(a) || std::isnan(b))
+		{
+			cmp = false;
+		}
+		else
+		{
+			cmp = result(a < b, a == b);
+		}
+	}
+	else if (areOperandsSigned())
+	{
+		cmp = result(lhs->getInt() < rhs->getInt(),
+					 lhs->getInt() == rhs->getInt());
+	}
+	else
+	{
+		cmp = result(lhs->getUInt() < rhs->getUInt(),
+					 lhs->getUInt() == rhs->getUInt());
+	}
+	
+	return Value::fromUInt(cmp, BoolType::get());
+}
+
 BinOpCompare::BinOpCompare(Expression* LHS, OString op, Expression* RHS)
 :BinOpExpr(LHS, op, RHS)
 {
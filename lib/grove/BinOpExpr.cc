@@ -7,6 +7,7 @@
 */
 
 #include <grove/BinOpExpr.h>
+#include <grove/Value.h>
 
 #include <grove/types/Type.h>
 
@@ -29,6 +30,12 @@ bool BinOpExpr::areTypesCompatible() const
 
 bool BinOpExpr::areTypesCastable() const
 {
+	if (getLHS()->getType()->isVectorTy() || getRHS()->getType()->isVectorTy())
+	{
+		return Type::compare(getLHS()->getType(), getRHS()->getType()) !=
+			INCOMPATIBLE;
+	}
+	
 	if (getLHS()->getType()->isPODTy() && getRHS()->getType()->isPODTy())
 	{
 		return true;
@@ -51,16 +58,69 @@ bool BinOpExpr::requiresCast() const
 
 bool BinOpExpr::isFloatingPointOperation() const
 {
+	// A scalar used with a vector is converted to the vector's lanes.
+	if (getVectorTy() != nullptr)
+	{
+		return getVectorTy()->getBaseTy()->isFloatingPointTy();
+	}
+	
 	return getLHS()->getType()->isFloatingPointTy() ||
     	getRHS()->getType()->isFloatingPointTy();
 }
 
 bool BinOpExpr::areOperandsSigned() const
 {
+	if (getVectorTy() != nullptr)
+	{
+		return getVectorTy()->isSigned();
+	}
+	
 	return getLHS()->getType()->isSigned() ||
     	getRHS()->getType()->isSigned();
 }
 
+Type* BinOpExpr::getVectorTy() const
+{
+	if (getLHS()->getType()->isVectorTy())
+	{
+		return getLHS()->getType();
+	}
+	else if (getRHS()->getType()->isVectorTy())
+	{
+		return getRHS()->getType();
+	}
+	
+	return nullptr;
+}
+
+bool BinOpExpr::convertOperands(Value* lhs, Value* rhs) const
+{
+	auto isScalar = [](Value* val) -> bool
+	{
+		return val != nullptr && (val->getType()->isIntTy() ||
+			val->getType()->isFloatingPointTy() || val->getType()->isBoolTy());
+	};
+	
+	if (isScalar(lhs) == false || isScalar(rhs) == false)
+	{
+		return false;
+	}
+	
+	switch (compare(getLHS(), getRHS()))
+	{
+		case LOWER_PRECEDENCE:
+			lhs->convert(rhs->getType());
+			break;
+		case HIGHER_PRECEDENCE:
+			rhs->convert(lhs->getType());
+			break;
+		default:
+			break;
+	}
+	
+	return true;
+}
+
 Expression* BinOpExpr::getLHS() const
 {
 	return m_LHS;
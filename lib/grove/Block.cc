@@ -27,17 +27,17 @@ Named* Block::namedOrGenericInstance(Named* n, Type* t) const
 		n->as<Genericable *>()->isGeneric())
 	{
 		auto generic = n->as<Genericable *>();
-		if (generic->hasInstance(t))
-		{
-			return generic->findInstance(t)->as<Named *>();
-		}
-		else
+		
+		auto found = generic->findInstance(t);
+		if (found != nullptr)
 		{
-			auto inst = generic->createInstance(t)->as<Named *>();
-			getModule()->findDependencies(inst->as<ASTNode *>());
-			getModule()->resolve(inst->as<ASTNode *>());
-			return inst;
+			return found->as<Named *>();
 		}
+		
+		auto inst = generic->createInstance(t)->as<Named *>();
+		getModule()->findDependencies(inst->as<ASTNode *>());
+		getModule()->resolve(inst->as<ASTNode *>());
+		return inst;
 	}
 	
 	return n;
@@ -6,4 +6,74 @@
 ** may not be copied, modified, or distributed except according to those terms.
 */
 
-#include <grove/BuildSettings.h>
\ No newline at end of file
+#include <grove/BuildSettings.h>
+
+bool BuildSettings::getShareInstances() const
+{
+	return m_share_instances;
+}
+
+void BuildSettings::setShareInstances(bool share)
+{
+	m_share_instances = share;
+}
+
+bool BuildSettings::getBoundsCheck() const
+{
+	return m_bounds_check;
+}
+
+void BuildSettings::setBoundsCheck(bool check)
+{
+	m_bounds_check = check;
+}
+
+int BuildSettings::getInlineThreshold() const
+{
+	return m_inline_threshold;
+}
+
+void BuildSettings::setInlineThreshold(int threshold)
+{
+	m_inline_threshold = threshold;
+}
+
+bool BuildSettings::getProfileGenerate() const
+{
+	return m_profile_generate;
+}
+
+void BuildSettings::setProfileGenerate(bool generate)
+{
+	m_profile_generate = generate;
+}
+
+std::string BuildSettings::getProfileUse() const
+{
+	return m_profile_use;
+}
+
+void BuildSettings::setProfileUse(std::string path)
+{
+	m_profile_use = path;
+}
+
+bool BuildSettings::getEmitUnoptimized() const
+{
+	return m_emit_unoptimized;
+}
+
+void BuildSettings::setEmitUnoptimized(bool unoptimized)
+{
+	m_emit_unoptimized = unoptimized;
+}
+
+bool BuildSettings::getFastMath() const
+{
+	return m_fast_math;
+}
+
+void BuildSettings::setFastMath(bool fast)
+{
+	m_fast_math = fast;
+}
@@ -11,6 +11,9 @@
 #include <grove/Library.h>
 #include <grove/Module.h>
 #include <grove/Function.h>
+#include <grove/Profile.h>
+
+#include <grove/types/Type.h>
 
 #include <grove/exceptions/fatal_error.h>
 
@@ -19,10 +22,16 @@
 #include <util/link.h>
 #include <util/string.h>
 
+#include <libor/parallel.h>
+#include <libor/profile.h>
+
 #include <llvm/ExecutionEngine/GenericValue.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
 #include <llvm/IR/Module.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/Path.h>
+#include <llvm/ADT/SmallString.h>
 #include <llvm/Support/TargetRegistry.h>
 #include <llvm/ADT/Triple.h>
 #include <llvm/MC/SubtargetFeature.h>
@@ -40,6 +49,11 @@ BuildSettings* Builder::getSettings() const
 	return m_settings;
 }
 
+Profile* Builder::getProfile() const
+{
+	return m_profile;
+}
+
 std::vector<Module *> Builder::getModules() const
 {
 	return m_modules;
@@ -99,6 +113,13 @@ int Builder::run()
 	}
 
 	engine->clearAllGlobalMappings();
+	
+	// The runtime is compiled into this process; point JIT code at it.
+	llvm::sys::DynamicLibrary::AddSymbol("orange_parallel_for",
+		(void *)&orange_parallel_for);
+	llvm::sys::DynamicLibrary::AddSymbol("orange_profile_write",
+		(void *)&orange_profile_write);
+	
 	engine->finalizeObject();
 
 	auto func = run_module->getMain()->getLLVMFunction();
@@ -109,6 +130,48 @@ int Builder::run()
 	return status.IntVal.getSExtValue();
 }
 
+bool Builder::claimInstance(std::string mangled_name)
+{
+	if (getSettings()->getShareInstances() == false)
+	{
+		return true;
+	}
+	
+	return m_defined_instances.insert(mangled_name).second;
+}
+
+void Builder::printStatistics(std::ostream& out) const
+{
+	unsigned int generics = 0;
+	unsigned int instances = 0;
+	
+	out << "Generic instantiations:\n";
+	
+	for (auto mod : getModules())
+	{
+		for (auto func : mod->getMain()->findChildren<Function *>())
+		{
+			if (func->isGeneric() == false || func->getType() == nullptr)
+			{
+				continue;
+			}
+			
+			auto count = func->getInstances().size();
+			
+			out << "\t" << func->getName().str() << " "
+			    << func->getType()->getString() << ": " << count
+			    << " instance(s), reused " << func->getInstanceHits()
+			    << " time(s)\n";
+			
+			generics++;
+			instances += count;
+		}
+	}
+	
+	out << "\t" << instances << " instance(s) of " << generics
+	    << " generic(s)\n";
+}
+
 void Builder::link(std::string outputPath)
 {
 	auto options = getLinkFlags();
@@ -143,6 +206,44 @@ void Builder::link(std::string outputPath)
 	}
 }
 
+void Builder::emit(std::string outputPath, EmitKind kind)
+{
+	std::string extension = "o";
+	
+	switch (kind)
+	{
+		case EMIT_OBJ:
+#ifdef _WIN32
+			extension = "obj";
+#endif
+			break;
+		case EMIT_ASM:
+			extension = "s";
+			break;
+		case EMIT_LLVM:
+			extension = "ll";
+			break;
+		case EMIT_BC:
+			extension = "bc";
+			break;
+	}
+	
+	for (auto mod : m_modules)
+	{
+		auto path = outputPath;
+		
+		if (path == "" || m_modules.size() > 1)
+		{
+			llvm::SmallString<128> name(
+				llvm::sys::path::filename(mod->getFile()));
+			llvm::sys::path::replace_extension(name, extension);
+			path = name.str().str();
+		}
+		
+		mod->emit(path, kind);
+	}
+}
+
 void Builder::initializeLLVM()
 {
 	LLVMInitializeNativeTarget();
@@ -170,6 +271,13 @@ void Builder::initializeLLVM()
 
 	llvm::TargetOptions options;
 
+	if (m_settings->getFastMath())
+	{
+		options.UnsafeFPMath = true;
+		options.NoNaNsFPMath = true;
+		options.NoInfsFPMath = true;
+	}
+
 	m_target_machine = target->createTargetMachine(triple.getTriple(),
 	  name, featuresStr, options, llvm::Reloc::Default,
 	  llvm::CodeModel::Default);
@@ -181,6 +289,11 @@ void Builder::initialize()
 
 	initializeLLVM();
 
+	if (m_settings->getProfileUse() != "")
+	{
+		m_profile = new Profile(m_settings->getProfileUse());
+	}
+
 	auto mod = new Module(this, m_build_path);
 	m_modules.push_back(mod);
 }
@@ -190,6 +303,7 @@ std::vector<const char*> Builder::getLinkFlags() const
 	std::vector<const char*> options;
 
 	options.push_back(BOOTSTRAP_LOCATION);
+	options.push_back(RUNTIME_LOCATION);
 
 #if defined(__APPLE__)
 	options.push_back("-w");
@@ -198,6 +312,7 @@ std::vector<const char*> Builder::getLinkFlags() const
 #elif defined(__linux__)
 	options.push_back("-I/lib64/ld-linux-x86-64.so.2");
 	options.push_back("-lc");
+	options.push_back("-lpthread");
 #elif defined(_WIN32)
 	options.push_back("-LC:/Windows/System32");
 	options.push_back("-lmsvcrt");
@@ -231,6 +346,7 @@ Builder::~Builder()
 {
 	delete m_library;
 	delete m_settings;
+	delete m_profile;
 
 	for (auto module : m_modules)
 	{
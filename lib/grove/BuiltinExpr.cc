@@ -0,0 +1,905 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <grove/BuiltinExpr.h>
+#include <grove/IDReference.h>
+#include <grove/Module.h>
+#include <grove/Value.h>
+
+#include <grove/types/Type.h>
+#include <grove/types/BoolType.h>
+#include <grove/types/VoidType.h>
+#include <grove/types/VectorType.h>
+
+#include <grove/exceptions/code_error.h>
+#include <grove/exceptions/invalid_type_error.h>
+
+#include <util/copy.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+
+#include <llvm/IR/Module.h>
+#include <llvm/IR/DataLayout.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/MDBuilder.h>
+
+static bool isIntBuiltin(OString name)
+{
+	return name == "popcount" || name == "clz" || name == "ctz" ||
+		name == "bswap" || name == "rotl" || name == "rotr";
+}
+
+static bool isHintBuiltin(OString name)
+{
+	return name == "likely" || name == "unlikely";
+}
+
+static bool isAtomicBuiltin(OString name)
+{
+	return name == "atomic_load" || name == "atomic_store" ||
+		name == "atomic_exchange" || name == "atomic_cas" ||
+		name == "atomic_add" || name == "atomic_sub" ||
+		name == "atomic_and" || name == "atomic_or" || name == "atomic_xor";
+}
+
+/// Gets the number of values an atomic builtin takes, not counting its
+/// memory ordering.
+static unsigned int getAtomicArgCount(OString name)
+{
+	if (name == "atomic_load")
+	{
+		return 1;
+	}
+	else if (name == "atomic_cas")
+	{
+		return 3;
+	}
+
+	return 2;
+}
+
+static bool isVectorBuiltin(OString name)
+{
+	return name == "splat" || name == "shuffle" || name == "select" ||
+		name == "reduce_add" || name == "reduce_mul" ||
+		name == "reduce_min" || name == "reduce_max" ||
+		name == "reduce_and" || name == "reduce_or";
+}
+
+/// Creates a shuffle mask that takes count lanes, starting at first.
+static llvm::Constant* createMask(LLVMBuilder* builder, unsigned int first,
+								  unsigned int count)
+{
+	std::vector<llvm::Constant *> mask;
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		mask.push_back(builder->getInt32(first + i));
+	}
+
+	return llvm::ConstantVector::get(mask);
+}
+
+static bool isOrdering(OString name)
+{
+	return name == "relaxed" || name == "acquire" || name == "release" ||
+		name == "acq_rel" || name == "seq_cst";
+}
+
+static llvm::AtomicOrdering getLLVMOrdering(OString name)
+{
+	if (name == "relaxed")
+	{
+		return llvm::Monotonic;
+	}
+	else if (name == "acquire")
+	{
+		return llvm::Acquire;
+	}
+	else if (name == "release")
+	{
+		return llvm::Release;
+	}
+	else if (name == "acq_rel")
+	{
+		return llvm::AcquireRelease;
+	}
+
+	return llvm::SequentiallyConsistent;
+}
+
+/// Keeps the low width bits of x.
+static uint64_t truncate(uint64_t x, unsigned int width)
+{
+	return width >= 64 ? x : x & ((uint64_t(1) << width) - 1);
+}
+
+void BuiltinExpr::expectArgs(unsigned int min, unsigned int max)
+{
+	if (m_args.size() >= min && m_args.size() <= max)
+	{
+		return;
+	}
+
+	auto name = m_name;
+	throw code_error(this, [name, min, max]() -> std::string
+		{
+			std::stringstream ss;
+			ss << name.str() << " takes ";
+
+			if (min == max)
+			{
+				ss << min;
+			}
+			else
+			{
+				ss << min << " to " << max;
+			}
+
+			ss << (max == 1 ? " argument" : " arguments");
+			return ss.str();
+		});
+}
+
+void BuiltinExpr::expectInt(Expression* arg)
+{
+	if (arg->getType()->isIntTy() == false)
+	{
+		throw invalid_type_error(arg, m_name.str() + " needs an integer, not "
+								 "a value of type", arg->getType());
+	}
+}
+
+uint64_t BuiltinExpr::getConstantArg(unsigned int idx, uint64_t max) const
+{
+	auto arg = m_args[idx];
+	auto value = arg->getType()->isIntTy() ? arg->fold() : nullptr;
+
+	if (value == nullptr || value->getInt() < 0 ||
+		value->getUInt() > max)
+	{
+		delete value;
+
+		auto name = m_name;
+		throw code_error(arg, [name, max]() -> std::string
+			{
+				std::stringstream ss;
+				ss << "argument of " << name.str() << " must be a constant "
+				   << "from 0 to " << max;
+				return ss.str();
+			});
+	}
+
+	auto result = value->getUInt();
+	delete value;
+
+	return result;
+}
+
+OString BuiltinExpr::getName() const
+{
+	return m_name;
+}
+
+std::vector<Expression *> BuiltinExpr::getArgs() const
+{
+	return m_args;
+}
+
+OString BuiltinExpr::getOrdering() const
+{
+	return m_ordering;
+}
+
+ASTNode* BuiltinExpr::copy() const
+{
+	auto copy = new BuiltinExpr(m_name, copyVector(m_args));
+	copy->m_ordering = m_ordering;
+	return copy;
+}
+
+void BuiltinExpr::resolve()
+{
+	if (m_name == "popcount" || m_name == "clz" || m_name == "ctz" ||
+		m_name == "bswap")
+	{
+		expectArgs(1, 1);
+		expectInt(m_args[0]);
+
+		auto width = m_args[0]->getType()->getIntegerBitWidth();
+		if (m_name == "bswap" && width % 16 != 0)
+		{
+			throw invalid_type_error(m_args[0], "bswap needs an integer "
+									 "with an even number of bytes, not a "
+									 "value of type", m_args[0]->getType());
+		}
+
+		setType(m_args[0]->getType());
+	}
+	else if (m_name == "rotl" || m_name == "rotr")
+	{
+		expectArgs(2, 2);
+		expectInt(m_args[0]);
+		expectInt(m_args[1]);
+
+		setType(m_args[0]->getType());
+	}
+	else if (m_name == "prefetch")
+	{
+		expectArgs(1, 3);
+
+		if (m_args[0]->getType()->isPointerTy() == false)
+		{
+			throw invalid_type_error(m_args[0], "prefetch needs a pointer, "
+									 "not a value of type",
+									 m_args[0]->getType());
+		}
+
+		if (m_args.size() > 1)
+		{
+			getConstantArg(1, 1);
+		}
+
+		if (m_args.size() > 2)
+		{
+			getConstantArg(2, 3);
+		}
+
+		setType(VoidType::get());
+	}
+	else if (m_name == "assume")
+	{
+		expectArgs(1, 1);
+
+		if (m_args[0]->getType()->isBoolTy() == false)
+		{
+			throw invalid_type_error(m_args[0], "assume needs a condition, "
+									 "not a value of type",
+									 m_args[0]->getType());
+		}
+
+		setType(VoidType::get());
+	}
+	else if (m_name == "unreachable")
+	{
+		expectArgs(0, 0);
+		setType(VoidType::get());
+	}
+	else if (isAtomicBuiltin(m_name))
+	{
+		auto count = getAtomicArgCount(m_name);
+		expectArgs(count, count);
+
+		auto ptr_ty = m_args[0]->getType();
+		if (ptr_ty->isPointerTy() == false ||
+			ptr_ty->getBaseTy()->isIntTy() == false)
+		{
+			throw invalid_type_error(m_args[0], m_name.str() + " needs a "
+									 "pointer to an integer, not a value of "
+									 "type", ptr_ty);
+		}
+
+		for (unsigned int i = 1; i < m_args.size(); i++)
+		{
+			expectInt(m_args[i]);
+		}
+
+		// A load can't release and a store can't acquire.
+		if ((m_name == "atomic_load" && (m_ordering == "release" ||
+										 m_ordering == "acq_rel")) ||
+			(m_name == "atomic_store" && (m_ordering == "acquire" ||
+										  m_ordering == "acq_rel")))
+		{
+			auto name = m_name;
+			auto ordering = m_ordering;
+			throw code_error(this, [name, ordering]() -> std::string
+				{
+					std::stringstream ss;
+					ss << name.str() << " can't use " << ordering.str()
+					   << " ordering";
+					return ss.str();
+				});
+		}
+
+		if (m_name == "atomic_store")
+		{
+			setType(VoidType::get());
+		}
+		else
+		{
+			setType(ptr_ty->getBaseTy());
+		}
+	}
+	else if (isVectorBuiltin(m_name))
+	{
+		resolveVector();
+	}
+	else if (isHintBuiltin(m_name))
+	{
+		expectArgs(1, 1);
+
+		if (m_args[0]->getType()->isBoolTy() == false)
+		{
+			throw invalid_type_error(m_args[0], m_name.str() + " needs a "
+									 "condition, not a value of type",
+									 m_args[0]->getType());
+		}
+
+		setType(BoolType::get());
+	}
+	else
+	{
+		throw code_error(this, []() -> std::string
+			{
+				return "unknown builtin";
+			});
+	}
+}
+
+void BuiltinExpr::build()
+{
+	auto mod = getModule()->getLLVMModule();
+
+	for (auto arg : m_args)
+	{
+		arg->build();
+	}
+
+	if (m_name == "unreachable")
+	{
+		IRBuilder()->CreateUnreachable();
+
+		// Anything after this can't run, but it still needs a block to be
+		// built in.
+		auto func = IRBuilder()->GetInsertBlock()->getParent();
+		auto after = llvm::BasicBlock::Create(getModule()->getLLVMContext(),
+											  "unreachable.after", func);
+		IRBuilder()->SetInsertPoint(after);
+
+		setValue(nullptr);
+		return;
+	}
+
+	if (m_name == "assume")
+	{
+		auto assume = llvm::Intrinsic::getDeclaration(mod,
+			llvm::Intrinsic::assume);
+		setValue(IRBuilder()->CreateCall(assume,
+			m_args[0]->castTo(BoolType::get())));
+		return;
+	}
+
+	if (isAtomicBuiltin(m_name))
+	{
+		buildAtomic();
+		return;
+	}
+
+	if (isVectorBuiltin(m_name))
+	{
+		buildVector();
+		return;
+	}
+
+	if (isHintBuiltin(m_name))
+	{
+		// The hint is read by the branch that uses this value.
+		setValue(m_args[0]->castTo(BoolType::get()));
+		return;
+	}
+
+	if (m_name == "prefetch")
+	{
+		auto rw = m_args.size() > 1 ? getConstantArg(1, 1) : 0;
+		auto locality = m_args.size() > 2 ? getConstantArg(2, 3) : 3;
+
+		auto prefetch = llvm::Intrinsic::getDeclaration(mod,
+			llvm::Intrinsic::prefetch);
+
+		// The last argument selects the data cache.
+		llvm::Value* args[] = {
+			IRBuilder()->CreateBitCast(m_args[0]->getValue(),
+									   IRBuilder()->getInt8PtrTy()),
+			IRBuilder()->getInt32(rw),
+			IRBuilder()->getInt32(locality),
+			IRBuilder()->getInt32(1)
+		};
+
+		setValue(IRBuilder()->CreateCall(prefetch, args));
+		return;
+	}
+
+	auto ty = getType()->getLLVMType();
+	auto x = m_args[0]->castTo(getType());
+
+	llvm::Value* val = nullptr;
+
+	if (m_name == "popcount" || m_name == "bswap")
+	{
+		auto id = m_name == "popcount" ? llvm::Intrinsic::ctpop :
+			llvm::Intrinsic::bswap;
+		auto intrinsic = llvm::Intrinsic::getDeclaration(mod, id, ty);
+		val = IRBuilder()->CreateCall(intrinsic, x);
+	}
+	else if (m_name == "clz" || m_name == "ctz")
+	{
+		auto id = m_name == "clz" ? llvm::Intrinsic::ctlz :
+			llvm::Intrinsic::cttz;
+		auto intrinsic = llvm::Intrinsic::getDeclaration(mod, id, ty);
+
+		// Zero gives the width of x rather than an undefined value.
+		llvm::Value* args[] = { x, IRBuilder()->getFalse() };
+		val = IRBuilder()->CreateCall(intrinsic, args);
+	}
+	else
+	{
+		// LLVM doesn't have a rotate intrinsic, but the backend turns this
+		// pattern into a rotate instruction.
+		auto width = llvm::ConstantInt::get(ty, ty->getIntegerBitWidth());
+		auto n = IRBuilder()->CreateURem(m_args[1]->castTo(getType()), width);
+		auto back = IRBuilder()->CreateURem(IRBuilder()->CreateSub(width, n),
+											width);
+
+		if (m_name == "rotl")
+		{
+			val = IRBuilder()->CreateOr(IRBuilder()->CreateShl(x, n),
+										IRBuilder()->CreateLShr(x, back));
+		}
+		else
+		{
+			val = IRBuilder()->CreateOr(IRBuilder()->CreateLShr(x, n),
+										IRBuilder()->CreateShl(x, back));
+		}
+	}
+
+	setValue(val);
+}
+
+void BuiltinExpr::buildAtomic()
+{
+	auto ptr = m_args[0]->getValue();
+	auto elem_ty = m_args[0]->getType()->getBaseTy();
+	auto ordering = getLLVMOrdering(m_ordering);
+
+	// Atomic loads and stores have to give their alignment.
+	auto layout = getModule()->getLLVMModule()->getDataLayout();
+	auto align = layout->getTypeStoreSize(elem_ty->getLLVMType());
+
+	if (m_name == "atomic_load")
+	{
+		auto load = IRBuilder()->CreateLoad(ptr);
+		load->setAtomic(ordering);
+		load->setAlignment(align);
+		setValue(load);
+		return;
+	}
+
+	if (m_name == "atomic_store")
+	{
+		auto store = IRBuilder()->CreateStore(m_args[1]->castTo(elem_ty), ptr);
+		store->setAtomic(ordering);
+		store->setAlignment(align);
+		setValue(nullptr);
+		return;
+	}
+
+	if (m_name == "atomic_cas")
+	{
+		auto failure = llvm::AtomicCmpXchgInst::getStrongestFailureOrdering(
+			ordering);
+		auto cas = IRBuilder()->CreateAtomicCmpXchg(ptr,
+			m_args[1]->castTo(elem_ty), m_args[2]->castTo(elem_ty), ordering,
+			failure);
+
+		// cmpxchg gives the old value and whether it was replaced.
+		setValue(IRBuilder()->CreateExtractValue(cas, 0));
+		return;
+	}
+
+	auto op = llvm::AtomicRMWInst::Xchg;
+
+	if (m_name == "atomic_add")
+	{
+		op = llvm::AtomicRMWInst::Add;
+	}
+	else if (m_name == "atomic_sub")
+	{
+		op = llvm::AtomicRMWInst::Sub;
+	}
+	else if (m_name == "atomic_and")
+	{
+		op = llvm::AtomicRMWInst::And;
+	}
+	else if (m_name == "atomic_or")
+	{
+		op = llvm::AtomicRMWInst::Or;
+	}
+	else if (m_name == "atomic_xor")
+	{
+		op = llvm::AtomicRMWInst::Xor;
+	}
+
+	setValue(IRBuilder()->CreateAtomicRMW(op, ptr, m_args[1]->castTo(elem_ty),
+										  ordering));
+}
+
+void BuiltinExpr::resolveVector()
+{
+	auto expectVector = [this](Expression* arg)
+	{
+		if (arg->getType()->isVectorTy() == false)
+		{
+			throw invalid_type_error(arg, m_name.str() + " needs a vector, "
+									 "not a value of type", arg->getType());
+		}
+	};
+
+	if (m_name == "splat")
+	{
+		expectArgs(2, 2);
+
+		auto ty = m_args[0]->getType();
+		if (ty->isIntTy() == false && ty->isFloatingPointTy() == false &&
+			ty->isBoolTy() == false)
+		{
+			throw invalid_type_error(m_args[0], "splat needs a number, not a "
+									 "value of type", ty);
+		}
+
+		auto lanes = getConstantArg(1, UINT16_MAX);
+		if (lanes == 0)
+		{
+			throw code_error(m_args[1], []() -> std::string
+				{
+					return "a vector must have at least one lane";
+				});
+		}
+
+		setType(VectorType::get(ty, (unsigned int)lanes));
+	}
+	else if (m_name == "shuffle")
+	{
+		expectArgs(2, std::max<size_t>(m_args.size(), 2));
+		expectVector(m_args[0]);
+
+		auto ty = m_args[0]->getType()->as<VectorType *>();
+		auto lanes = ty->getSize();
+		unsigned int first_idx = 1;
+
+		if (m_args[1]->getType()->isVectorTy())
+		{
+			if (m_args[1]->getType() != ty)
+			{
+				throw invalid_type_error(m_args[1], "shuffle needs two "
+										 "vectors of the same type, not a "
+										 "value of type",
+										 m_args[1]->getType());
+			}
+
+			expectArgs(3, std::max<size_t>(m_args.size(), 3));
+			lanes *= 2;
+			first_idx = 2;
+		}
+
+		for (unsigned int i = first_idx; i < m_args.size(); i++)
+		{
+			getConstantArg(i, lanes - 1);
+		}
+
+		setType(VectorType::get(ty->getBaseTy(), m_args.size() - first_idx));
+	}
+	else if (m_name == "select")
+	{
+		expectArgs(3, 3);
+		expectVector(m_args[0]);
+		expectVector(m_args[1]);
+
+		auto mask_ty = m_args[0]->getType()->as<VectorType *>();
+		auto ty = m_args[1]->getType()->as<VectorType *>();
+
+		if (mask_ty->getBaseTy()->isBoolTy() == false ||
+			mask_ty->getSize() != ty->getSize())
+		{
+			throw invalid_type_error(m_args[0], "select needs a mask with a "
+									 "bool for each lane, not a value of "
+									 "type", mask_ty);
+		}
+
+		if (Type::compare(ty, m_args[2]->getType()) == INCOMPATIBLE)
+		{
+			throw invalid_type_error(m_args[2], "select needs values of the "
+									 "same type, not a value of type",
+									 m_args[2]->getType());
+		}
+
+		setType(ty);
+	}
+	else
+	{
+		expectArgs(1, 1);
+		expectVector(m_args[0]);
+
+		auto elem_ty = m_args[0]->getType()->getBaseTy();
+		if ((m_name == "reduce_and" || m_name == "reduce_or") &&
+			elem_ty->isFloatingPointTy())
+		{
+			throw invalid_type_error(m_args[0], m_name.str() + " needs "
+									 "integers or bools, not a vector of "
+									 "type", m_args[0]->getType());
+		}
+
+		setType(elem_ty);
+	}
+}
+
+void BuiltinExpr::buildVector()
+{
+	if (m_name == "splat")
+	{
+		auto lanes = getType()->as<VectorType *>()->getSize();
+		setValue(IRBuilder()->CreateVectorSplat(lanes, m_args[0]->getValue()));
+		return;
+	}
+
+	if (m_name == "shuffle")
+	{
+		auto a = m_args[0]->getValue();
+		llvm::Value* b = llvm::UndefValue::get(a->getType());
+		unsigned int first_idx = 1;
+
+		if (m_args[1]->getType()->isVectorTy())
+		{
+			b = m_args[1]->getValue();
+			first_idx = 2;
+		}
+
+		std::vector<llvm::Constant *> mask;
+		for (unsigned int i = first_idx; i < m_args.size(); i++)
+		{
+			mask.push_back(IRBuilder()->getInt32(getConstantArg(i, UINT16_MAX)));
+		}
+
+		setValue(IRBuilder()->CreateShuffleVector(a, b,
+			llvm::ConstantVector::get(mask)));
+		return;
+	}
+
+	if (m_name == "select")
+	{
+		setValue(IRBuilder()->CreateSelect(m_args[0]->getValue(),
+			m_args[1]->getValue(), m_args[2]->castTo(getType())));
+		return;
+	}
+
+	// Combine the upper half of the vector with the lower half while the
+	// number of lanes is even, then combine what's left one lane at a time.
+	auto vec = m_args[0]->getValue();
+	auto lanes = m_args[0]->getType()->as<VectorType *>()->getSize();
+	auto undef = llvm::UndefValue::get(vec->getType());
+
+	while (lanes > 1 && lanes % 2 == 0)
+	{
+		lanes /= 2;
+
+		auto low = IRBuilder()->CreateShuffleVector(vec, undef,
+			createMask(IRBuilder(), 0, lanes));
+		auto high = IRBuilder()->CreateShuffleVector(vec, undef,
+			createMask(IRBuilder(), lanes, lanes));
+
+		vec = combine(low, high);
+		undef = llvm::UndefValue::get(vec->getType());
+	}
+
+	auto result = IRBuilder()->CreateExtractElement(vec,
+		IRBuilder()->getInt32(0));
+
+	for (unsigned int i = 1; i < lanes; i++)
+	{
+		result = combine(result, IRBuilder()->CreateExtractElement(vec,
+			IRBuilder()->getInt32(i)));
+	}
+
+	setValue(result);
+}
+
+llvm::Value* BuiltinExpr::combine(llvm::Value* a, llvm::Value* b) const
+{
+	auto fp = getType()->isFloatingPointTy();
+
+	if (m_name == "reduce_add")
+	{
+		return fp ? IRBuilder()->CreateFAdd(a, b) : IRBuilder()->CreateAdd(a, b);
+	}
+	else if (m_name == "reduce_mul")
+	{
+		return fp ? IRBuilder()->CreateFMul(a, b) : IRBuilder()->CreateMul(a, b);
+	}
+	else if (m_name == "reduce_and")
+	{
+		return IRBuilder()->CreateAnd(a, b);
+	}
+	else if (m_name == "reduce_or")
+	{
+		return IRBuilder()->CreateOr(a, b);
+	}
+
+	llvm::Value* less = nullptr;
+
+	if (fp)
+	{
+		less = IRBuilder()->CreateFCmpOLT(a, b);
+	}
+	else if (getType()->isSigned())
+	{
+		less = IRBuilder()->CreateICmpSLT(a, b);
+	}
+	else
+	{
+		less = IRBuilder()->CreateICmpULT(a, b);
+	}
+
+	if (m_name == "reduce_min")
+	{
+		return IRBuilder()->CreateSelect(less, a, b);
+	}
+
+	return IRBuilder()->CreateSelect(less, b, a);
+}
+
+bool BuiltinExpr::isPure() const
+{
+	if (isIntBuiltin(m_name) == false && isHintBuiltin(m_name) == false)
+	{
+		return false;
+	}
+
+	for (auto arg : m_args)
+	{
+		if (arg->isPure() == false)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+Value* BuiltinExpr::fold() const
+{
+	if (isHintBuiltin(m_name))
+	{
+		return m_args[0]->fold();
+	}
+
+	if (isIntBuiltin(m_name) == false)
+	{
+		return nullptr;
+	}
+
+	auto x_val = m_args[0]->fold();
+	if (x_val == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto width = getType()->getIntegerBitWidth();
+	auto x = truncate(x_val->getUInt(), width);
+	delete x_val;
+
+	uint64_t result = 0;
+
+	if (m_name == "popcount")
+	{
+		for ( ; x != 0; x &= x - 1)
+		{
+			result++;
+		}
+	}
+	else if (m_name == "clz")
+	{
+		for (result = 0; result < width; result++)
+		{
+			if ((x >> (width - 1 - result)) & 1)
+			{
+				break;
+			}
+		}
+	}
+	else if (m_name == "ctz")
+	{
+		for (result = 0; result < width; result++)
+		{
+			if ((x >> result) & 1)
+			{
+				break;
+			}
+		}
+	}
+	else if (m_name == "bswap")
+	{
+		for (unsigned int i = 0; i < width / 8; i++)
+		{
+			result = (result << 8) | ((x >> (i * 8)) & 0xff);
+		}
+	}
+	else
+	{
+		auto n_val = m_args[1]->fold();
+		if (n_val == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto n = truncate(n_val->getUInt(), m_args[1]->getType()
+						  ->getIntegerBitWidth()) % width;
+		delete n_val;
+
+		if (m_name == "rotr")
+		{
+			n = (width - n) % width;
+		}
+
+		result = n == 0 ? x : truncate((x << n) | (x >> (width - n)), width);
+	}
+
+	return Value::fromUInt(result, getType());
+}
+
+llvm::MDNode* BuiltinExpr::getBranchWeights(Expression* cond)
+{
+	if (cond->ASTNode::is<BuiltinExpr *>() == false ||
+		isHintBuiltin(cond->ASTNode::as<BuiltinExpr *>()->getName()) == false)
+	{
+		return nullptr;
+	}
+
+	// These are the weights LLVM gives to llvm.expect.
+	const uint32_t likely_weight = 64;
+	const uint32_t unlikely_weight = 4;
+
+	auto name = cond->ASTNode::as<BuiltinExpr *>()->getName();
+	auto likely = name == "likely";
+
+	llvm::MDBuilder md(cond->getModule()->getLLVMContext());
+
+	if (likely)
+	{
+		return md.createBranchWeights(likely_weight, unlikely_weight);
+	}
+	else
+	{
+		return md.createBranchWeights(unlikely_weight, likely_weight);
+	}
+}
+
+BuiltinExpr::BuiltinExpr(OString name, std::vector<Expression *> args)
+{
+	// The memory ordering of an atomic builtin is a name rather than a
+	// value, so it's taken out of the arguments before they're resolved.
+	// Only a name after all of the values is an ordering; one in the place
+	// of a value is a variable, even if it's named like an ordering.
+	if (isAtomicBuiltin(name) && args.size() == getAtomicArgCount(name) + 1 &&
+		args.back()->ASTNode::is<IDReference *>() &&
+		isOrdering(args.back()->ASTNode::as<IDReference *>()->getName()))
+	{
+		m_ordering = args.back()->ASTNode::as<IDReference *>()->getName();
+		delete args.back();
+		args.pop_back();
+	}
+
+	m_name = name;
+	m_args = args;
+
+	for (auto arg : m_args)
+	{
+		addChild(arg, true);
+	}
+}
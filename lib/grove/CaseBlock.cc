@@ -0,0 +1,74 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <grove/CaseBlock.h>
+#include <grove/Expression.h>
+#include <grove/Value.h>
+
+#include <grove/types/Type.h>
+#include <grove/types/EnumType.h>
+
+#include <grove/exceptions/invalid_type_error.h>
+#include <grove/exceptions/code_error.h>
+#include <grove/exceptions/fatal_error.h>
+
+#include <util/assertions.h>
+#include <util/copy.h>
+
+std::vector<Expression *> CaseBlock::getValues() const
+{
+	return m_values;
+}
+
+void CaseBlock::resolve()
+{
+	for (auto value : getValues())
+	{
+		auto ty = value->getType();
+		assertExists(ty, "Value has no type!");
+		
+		if (ty->isIntTy() == false && ty->is<EnumType *>() == false)
+		{
+			throw invalid_type_error(value, "case value must be an integer, "
+									 "got", ty);
+		}
+		
+		auto folded = value->fold();
+		if (folded == nullptr)
+		{
+			throw code_error(value, []() -> std::string
+				{
+					return "case value must be a constant";
+				});
+		}
+		
+		delete folded;
+	}
+}
+
+ASTNode* CaseBlock::copy() const
+{
+	auto clone = new CaseBlock(copyVector(m_values));
+	clone->copyStatements(this);
+	return clone;
+}
+
+CaseBlock::CaseBlock(std::vector<Expression *> values)
+{
+	if (values.size() == 0)
+	{
+		throw fatal_error("CaseBlock created with no values");
+	}
+	
+	m_values = values;
+	
+	for (auto value : m_values)
+	{
+		addChild(value, true);
+	}
+}
@@ -7,6 +7,7 @@
 */
 
 #include <grove/CastExpr.h>
+#include <grove/Value.h>
 
 #include <grove/types/Type.h>
 
@@ -28,7 +29,7 @@ void CastExpr::resolve()
 	assertExists(old_ty, "Expression has no type");
 	
 	/// If this function throws an error, a cast isn't defined.
-	old_ty->castOperation(getType());
+	old_ty->castOperation(getType(), getExpression());
 }
 
 void CastExpr::build()
@@ -44,6 +45,38 @@ void CastExpr::build()
 	setValue(casted);
 }
 
+bool CastExpr::isPure() const
+{
+	return getExpression()->isPure();
+}
+
+Value* CastExpr::fold() const
+{
+	auto ty = getType();
+	if (ty->isIntTy() == false && ty->isFloatingPointTy() == false &&
+		ty->isBoolTy() == false)
+	{
+		return nullptr;
+	}
+	
+	auto val = getExpression()->fold();
+	if (val == nullptr)
+	{
+		return nullptr;
+	}
+	
+	auto val_ty = val->getType();
+	if (val_ty->isIntTy() == false && val_ty->isFloatingPointTy() == false &&
+		val_ty->isBoolTy() == false)
+	{
+		delete val;
+		return nullptr;
+	}
+	
+	val->convert(ty);
+	return val;
+}
+
 CastExpr::CastExpr(Type* ty, Expression* expr)
 {
 	m_type = ty;
@@ -0,0 +1,110 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <grove/ComptimeCall.h>
+#include <grove/Function.h>
+#include <grove/FunctionCall.h>
+#include <grove/Interpreter.h>
+#include <grove/Value.h>
+
+#include <grove/types/Type.h>
+
+#include <grove/exceptions/code_error.h>
+#include <grove/exceptions/invalid_type_error.h>
+
+FunctionCall* ComptimeCall::getCall() const
+{
+	return m_call;
+}
+
+ASTNode* ComptimeCall::copy() const
+{
+	return new ComptimeCall(m_call->copy()->as<FunctionCall *>());
+}
+
+void ComptimeCall::resolve()
+{
+	auto ty = m_call->getType();
+	
+	if (ty->isIntTy() == false && ty->isFloatingPointTy() == false &&
+		ty->isBoolTy() == false)
+	{
+		throw invalid_type_error(this, "cannot evaluate a call at compile "
+								 "time that returns", ty);
+	}
+	
+	if (m_call->getNode()->is<Function *>() == false)
+	{
+		throw code_error(this, []() -> std::string
+			{
+				return "only functions defined in Orange can be called at "
+					"compile time";
+			});
+	}
+	
+	std::vector<Value *> args;
+	
+	for (auto arg : m_call->getArgs())
+	{
+		auto val = arg->fold();
+		
+		if (val == nullptr)
+		{
+			for (auto folded : args)
+			{
+				delete folded;
+			}
+			
+			throw code_error(arg, []() -> std::string
+				{
+					return "argument of a const call must be a constant";
+				});
+		}
+		
+		args.push_back(val);
+	}
+	
+	Interpreter interpreter;
+	m_result = interpreter.call(m_call->getNode()->as<Function *>(), args,
+								m_call);
+	
+	addChild(m_result, true);
+	setType(ty);
+}
+
+void ComptimeCall::build()
+{
+	m_result->build();
+	setValue(m_result->getValue());
+}
+
+bool ComptimeCall::isConstant() const
+{
+	return m_result != nullptr;
+}
+
+bool ComptimeCall::isPure() const
+{
+	return true;
+}
+
+Value* ComptimeCall::fold() const
+{
+	if (m_result == nullptr)
+	{
+		return nullptr;
+	}
+	
+	return m_result->fold();
+}
+
+ComptimeCall::ComptimeCall(FunctionCall* call)
+{
+	addChild(call, true);
+	m_call = call;
+}
@@ -32,4 +32,23 @@ llvm::Value* Expression::castTo(Expression *expr) const
 bool Expression::isConstant() const
 {
 	return false;
+}
+
+bool Expression::isPure() const
+{
+	return false;
+}
+
+Value* Expression::fold() const
+{
+	return nullptr;
+}
+
+bool Expression::isCheap() const
+{
+	// The number of nodes an expression may have before it's considered
+	// too expensive to evaluate speculatively.
+	const size_t max_nodes = 8;
+	
+	return isPure() && findChildren<ASTNode *>().size() < max_nodes;
 }
\ No newline at end of file
@@ -8,8 +8,16 @@
 
 #include <grove/Function.h>
 #include <grove/Module.h>
+#include <grove/Builder.h>
+#include <grove/BuildSettings.h>
 #include <grove/ReturnStmt.h>
 #include <grove/Parameter.h>
+#include <grove/Profile.h>
+#include <grove/IDReference.h>
+#include <grove/ArrayAccessExpr.h>
+#include <grove/BinOpAssign.h>
+#include <grove/IncrementExpr.h>
+#include <grove/ReferenceExpr.h>
 
 #include <grove/types/Type.h>
 #include <grove/types/FunctionType.h>
@@ -20,18 +28,19 @@
 #include <grove/exceptions/already_defined_sig_error.h>
 #include <grove/exceptions/invalid_type_error.h>
 #include <grove/exceptions/fatal_error.h>
+#include <grove/exceptions/code_error.h>
 
 #include <util/assertions.h>
 #include <util/copy.h>
 
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Function.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Comdat.h>
+#include <llvm/ADT/Triple.h>
 #include <llvm/IR/IRBuilder.h>
-#include <llvm/IR/Verifier.h>
-#include <llvm/IR/LegacyPassManager.h>
-#include <llvm/CodeGen/Passes.h>
-#include <llvm/Analysis/Passes.h>
-#include <llvm/Transforms/Scalar.h>
+#include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/MDBuilder.h>
 
 llvm::BasicBlock* Function::getEntry() const
 {
@@ -43,6 +52,34 @@ llvm::BasicBlock* Function::getExit() const
 	return m_exit;
 }
 
+llvm::BasicBlock* Function::getTrapBlock()
+{
+	if (m_trap != nullptr)
+	{
+		return m_trap;
+	}
+	
+	m_trap = llvm::BasicBlock::Create(getModule()->getLLVMContext(), "trap",
+									  m_function);
+	
+	auto trap = llvm::Intrinsic::getDeclaration(getModule()->getLLVMModule(),
+												llvm::Intrinsic::trap);
+	
+	LLVMBuilder builder(m_trap);
+	builder.CreateCall(trap);
+	builder.CreateUnreachable();
+	
+	return m_trap;
+}
+
+llvm::AllocaInst* Function::createSlot(llvm::Type* ty, std::string name)
+{
+	assertExists(getEntry(), "Function has no entry block.");
+	
+	LLVMBuilder builder(getEntry(), getEntry()->begin());
+	return builder.CreateAlloca(ty, nullptr, name);
+}
+
 llvm::Value* Function::getRetValue() const
 {
 	return m_ret_value;
@@ -75,8 +112,16 @@ std::vector<Parameter *> Function::getParams() const
 
 OString Function::getMangledName() const
 {
+	// Functions from different modules can share a name and signature, so
+	// the module that defines the function is part of the name; otherwise
+	// the linker would keep only one of two different instances. Only that
+	// module is used, so every instance of a generic with the same types
+	// gets the same name and can be merged.
+	auto defining = isInstance() ? getInstanceParent() : this;
+	
 	std::stringstream ss;
-	ss << "_O" << getName().str().size() << getName().str();
+	ss << "_O" << defining->getModule()->getMangledName();
+	ss << getName().str().size() << getName().str();
 	ss << getType()->getSignature();
 	
 	return ss.str();
@@ -114,6 +159,47 @@ Type* Function::getReturnType() const
 	return ty->getBaseTy();
 }
 
+bool Function::isWritten(const Valued* var)
+{
+	if (m_found_writes)
+	{
+		return m_written.find(var) != m_written.end();
+	}
+	
+	for (auto ref : findChildren<IDReference *>())
+	{
+		auto node = ref->getNode();
+		if (node == nullptr)
+		{
+			continue;
+		}
+		
+		auto access = ref->getParent();
+		if (access->is<ArrayAccessExpr *>() == false ||
+			access->as<ArrayAccessExpr *>()->getArray() != ref)
+		{
+			m_written.insert(node);
+			continue;
+		}
+		
+		auto use = access->getParent();
+		if (use->is<IncrementExpr *>() || use->is<ReferenceExpr *>())
+		{
+			m_written.insert(node);
+			continue;
+		}
+		
+		if (use->is<BinOpAssign *>() &&
+			use->as<BinOpAssign *>()->getLHS() == access)
+		{
+			m_written.insert(node);
+		}
+	}
+	
+	m_found_writes = true;
+	return m_written.find(var) != m_written.end();
+}
+
 void Function::setReturnType(Type *ty)
 {
 	m_ret_type = ty;
@@ -129,6 +215,35 @@ bool Function::isInstance() const
 	return m_instance_of != nullptr;
 }
 
+bool Function::isExported() const
+{
+	// A shared instance may only be defined by another module.
+	return isInstance() && getModule()->getBuilder()->getSettings()
+		->getShareInstances();
+}
+
+void Function::addAttribute(OString name)
+{
+	if (name == "fastmath")
+	{
+		m_fast_math = true;
+		return;
+	}
+	
+	throw code_error(&name, [name]() -> std::string
+		{
+			std::stringstream ss;
+			ss << "unknown function attribute " << name.str();
+			return ss.str();
+		});
+}
+
+bool Function::isFastMath() const
+{
+	return m_fast_math ||
+		getModule()->getBuilder()->getSettings()->getFastMath();
+}
+
 bool Function::isVoidFunction() const
 {
 	auto retType = getReturnType();
@@ -192,12 +307,43 @@ Genericable* Function::createInstance(Type *type)
 	
 	clone->m_instance_of = this;
 	
-	m_instances.push_back(clone);
+	addInstance(clone, type);
 	getParent()->addChild(clone);
 	
 	return clone;
 }
 
+Type* Function::getInstanceKey(Type *type) const
+{
+	auto func_ty = type->as<FunctionType *>();
+	auto param_tys = getParamTys();
+	
+	if (func_ty == nullptr || func_ty->getArgs().size() != param_tys.size())
+	{
+		return nullptr;
+	}
+	
+	// An instance only takes the types of its var parameters from the
+	// call; the other parameters keep their declared types, and arguments
+	// passed to them are casted.
+	std::vector<Type *> args;
+	
+	for (unsigned int i = 0; i < param_tys.size(); i++)
+	{
+		auto arg = param_tys[i]->isVarTy() ? func_ty->getArgs()[i] : param_tys[i];
+		
+		// Wildcards match any instance, so they can't be used as a key.
+		if (arg->isVarTy() || arg->getBaseTy()->isVarTy())
+		{
+			return nullptr;
+		}
+		
+		args.push_back(arg);
+	}
+	
+	return FunctionType::get(VarType::get(), args);
+}
+
 
 bool Function::matchesType(Type *type) const
 {
@@ -244,6 +390,7 @@ ASTNode* Function::copy() const
 {
 	auto func = new Function(getModule(), getName(), copyVector(getParams()));
 	func->copyStatements(this);
+	func->m_fast_math = m_fast_math;
 	return func;
 }
 
@@ -370,10 +517,50 @@ void Function::createFunction()
 	
 	auto llvm_ty = (llvm::FunctionType *)(getType()->getLLVMType());
 	
-	auto linkage = llvm::GlobalValue::LinkageTypes::ExternalLinkage;
+	auto linkage = llvm::GlobalValue::LinkageTypes::InternalLinkage;
+	
+	if (isInstance())
+	{
+		// Every module that uses an instance may define it; the linker keeps
+		// one copy. A shared instance is only defined once per build, so it
+		// must not be discarded when unused by its defining module.
+		linkage = isExported() ?
+			llvm::GlobalValue::LinkageTypes::WeakODRLinkage :
+			llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage;
+	}
+	else if (isExported())
+	{
+		linkage = llvm::GlobalValue::LinkageTypes::ExternalLinkage;
+	}
+	
 	m_function = llvm::Function::Create(llvm_ty, linkage, getMangledName().str(),
 									   getModule()->getLLVMModule());
 	
+	if (isExported() == false)
+	{
+		m_function->setCallingConv(llvm::CallingConv::Fast);
+	}
+	
+	// Code generation reads these per function, so a fastmath function gets
+	// the same treatment as a --fast-math build.
+	if (isFastMath())
+	{
+		m_function->addFnAttr("unsafe-fp-math", "true");
+		m_function->addFnAttr("no-nans-fp-math", "true");
+		m_function->addFnAttr("no-infs-fp-math", "true");
+	}
+	
+	// MachO has no COMDAT support; its linker coalesces ODR definitions by
+	// name instead.
+	auto llvm_mod = getModule()->getLLVMModule();
+	auto triple = llvm::Triple(llvm_mod->getTargetTriple());
+	if (isInstance() && triple.isOSBinFormatMachO() == false)
+	{
+		auto comdat = llvm_mod->getOrInsertComdat(m_function->getName());
+		comdat->setSelectionKind(llvm::Comdat::Any);
+		m_function->setComdat(comdat);
+	}
+	
 	// Set argument names
 	auto arg_it = m_function->arg_begin();
 	for (unsigned int i = 0; i < m_params.size(); i++, arg_it++)
@@ -385,6 +572,25 @@ void Function::createFunction()
 									   "entry", m_function);
 	m_exit = llvm::BasicBlock::Create(getModule()->getLLVMContext(),
 									  "exit", m_function);
+	m_trap = nullptr;
+	
+	setValue(m_function);
+}
+
+void Function::declareFunction()
+{
+	assertExists(getType(), "Function does not have a type.");
+	
+	auto llvm_ty = (llvm::FunctionType *)(getType()->getLLVMType());
+	
+	auto linkage = llvm::GlobalValue::LinkageTypes::ExternalLinkage;
+	m_function = llvm::Function::Create(llvm_ty, linkage, getMangledName().str(),
+									   getModule()->getLLVMModule());
+	
+	if (isExported() == false)
+	{
+		m_function->setCallingConv(llvm::CallingConv::Fast);
+	}
 	
 	setValue(m_function);
 }
@@ -400,7 +606,7 @@ void Function::setupFunction()
 		auto param = getParams()[i];
 		
 		auto ty = param->getType()->getLLVMType();
-		auto alloc = IRBuilder()->CreateAlloca(ty);
+		auto alloc = createSlot(ty, param->getName().str());
 		
 		IRBuilder()->CreateStore(arg_it, alloc);
 		param->setValue(alloc);
@@ -409,7 +615,144 @@ void Function::setupFunction()
 	if (isVoidFunction() == false)
 	{
 		auto ret_ty = getReturnType()->getLLVMType();
-		m_ret_value = IRBuilder()->CreateAlloca(ret_ty);
+		m_ret_value = createSlot(ret_ty);
+	}
+}
+
+std::vector<llvm::BranchInst *> Function::getConditionalBranches() const
+{
+	std::vector<llvm::BranchInst *> branches;
+	
+	for (auto& block : m_function->getBasicBlockList())
+	{
+		auto branch = llvm::dyn_cast<llvm::BranchInst>(block.getTerminator());
+		if (branch != nullptr && branch->isConditional())
+		{
+			branches.push_back(branch);
+		}
+	}
+	
+	return branches;
+}
+
+void Function::instrumentProfile()
+{
+	auto hash = Profile::hash(m_function);
+	auto branches = getConditionalBranches();
+	
+	auto i64 = llvm::Type::getInt64Ty(getModule()->getLLVMContext());
+	auto counters_ty = llvm::ArrayType::get(i64, 1 + 2 * branches.size());
+	auto counters = new llvm::GlobalVariable(*getModule()->getLLVMModule(),
+		counters_ty, false, llvm::GlobalValue::PrivateLinkage,
+		llvm::ConstantAggregateZero::get(counters_ty),
+		"profile.counters." + m_function->getName());
+	
+	auto increment = [counters](LLVMBuilder& builder, uint64_t idx,
+								llvm::Value* delta)
+	{
+		// A function may run on several threads at once from a parallel
+		// for, so a plain load and store could lose counts.
+		auto ptr = builder.CreateConstInBoundsGEP2_64(counters, 0, idx);
+		builder.CreateAtomicRMW(llvm::AtomicRMWInst::Add, ptr, delta,
+								llvm::Monotonic);
+	};
+	
+	LLVMBuilder entry_builder(getEntry()->getTerminator());
+	increment(entry_builder, 0, entry_builder.getInt64(1));
+	
+	// Count without branching: one counter adds the condition, the other
+	// adds one.
+	for (unsigned int i = 0; i < branches.size(); i++)
+	{
+		LLVMBuilder builder(branches[i]);
+		auto taken = builder.CreateZExt(branches[i]->getCondition(), i64);
+		
+		increment(builder, 1 + 2 * i, taken);
+		increment(builder, 2 + 2 * i, builder.getInt64(1));
+	}
+	
+	getModule()->addProfileCounters(m_function, hash, counters);
+	
+	if (getModule()->getMain() != this)
+	{
+		return;
+	}
+	
+	std::vector<llvm::ReturnInst *> returns;
+	for (auto& block : m_function->getBasicBlockList())
+	{
+		auto ret = llvm::dyn_cast<llvm::ReturnInst>(block.getTerminator());
+		if (ret != nullptr)
+		{
+			returns.push_back(ret);
+		}
+	}
+	
+	for (auto ret : returns)
+	{
+		// A tail call would run after the profile is written, so main
+		// makes an ordinary call instead.
+		auto prev = ret->getPrevNode();
+		if (prev != nullptr && llvm::isa<llvm::CallInst>(prev))
+		{
+			llvm::cast<llvm::CallInst>(prev)->setTailCallKind(
+				llvm::CallInst::TCK_None);
+		}
+		
+		LLVMBuilder builder(ret);
+		builder.CreateCall(getModule()->getProfileWriter());
+	}
+}
+
+void Function::applyProfile()
+{
+	auto profile = getModule()->getBuilder()->getProfile();
+	auto branches = getConditionalBranches();
+	
+	auto counters = profile->getCounters(m_function->getName().str(),
+										 Profile::hash(m_function));
+	if (counters == nullptr || counters->size() != 1 + 2 * branches.size())
+	{
+		return;
+	}
+	
+	llvm::MDBuilder md(getModule()->getLLVMContext());
+	
+	for (unsigned int i = 0; i < branches.size(); i++)
+	{
+		auto taken = counters->at(1 + 2 * i);
+		auto total = std::max(counters->at(2 + 2 * i), taken);
+		
+		if (total == 0)
+		{
+			continue;
+		}
+		
+		// Weights are 32 bits wide; scale large counts down to fit. One is
+		// added so that a side that never ran is unlikely, not impossible.
+		auto scale = total / UINT32_MAX + 1;
+		auto weights = md.createBranchWeights(
+			uint32_t(taken / scale + 1), uint32_t((total - taken) / scale + 1));
+		
+		branches[i]->setMetadata(llvm::LLVMContext::MD_prof, weights);
+	}
+	
+	// main only runs once, but it's never cold.
+	if (getModule()->getMain() == this)
+	{
+		return;
+	}
+	
+	auto calls = double(counters->at(0));
+	auto max_calls = double(profile->getMaxEntryCount());
+	
+	if (calls >= 0.3 * max_calls)
+	{
+		m_function->addFnAttr(llvm::Attribute::InlineHint);
+	}
+	else if (calls <= 0.01 * max_calls)
+	{
+		m_function->addFnAttr(llvm::Attribute::Cold);
 	}
 }
 
@@ -425,16 +768,21 @@ void Function::optimize()
 		}
 	}
 	
-	llvm::legacy::FunctionPassManager FPM(getModule()->getLLVMModule());
-	FPM.add(llvm::createVerifierPass(true));
-	FPM.add(llvm::createBasicAliasAnalysisPass());
-	FPM.add(llvm::createPromoteMemoryToRegisterPass());
-	FPM.add(llvm::createInstructionCombiningPass());
-	FPM.add(llvm::createReassociatePass());
-	FPM.add(llvm::createGVNPass());
-	FPM.add(llvm::createCFGSimplificationPass());
-
-	FPM.run(*m_function);
+	if (getModule()->getBuilder()->getSettings()->getProfileGenerate())
+	{
+		instrumentProfile();
+	}
+	else if (getModule()->getBuilder()->getProfile() != nullptr)
+	{
+		applyProfile();
+	}
+	
+	// The module optimizes every function at once after copying the code
+	// when the unoptimized code is to be emitted.
+	if (getModule()->getBuilder()->getSettings()->getEmitUnoptimized() == false)
+	{
+		getModule()->optimizeFunction(m_function);
+	}
 }
 
 void Function::build()
@@ -449,15 +797,37 @@ void Function::build()
 		return;
 	}
 	
+	if (isInstance() && getModule()->getBuilder()->claimInstance(
+		getMangledName().str()) == false)
+	{
+		declareFunction();
+		return;
+	}
+	
 	// Save point.
 	auto stored_insert = IRBuilder()->GetInsertBlock();
 	
 	createFunction();
+	
+	// Floating point operations get this function's fast-math flags. A
+	// nested function sets its own while it's built.
+	auto stored_fmf = IRBuilder()->getFastMathFlags();
+	
+	llvm::FastMathFlags fmf;
+	if (isFastMath())
+	{
+		fmf.setUnsafeAlgebra();
+	}
+	
+	IRBuilder()->SetFastMathFlags(fmf);
+	
 	setupFunction();
 	buildStatements();
 	createReturn();
 	optimize();
 	
+	IRBuilder()->SetFastMathFlags(stored_fmf);
+	
 	// Restore point.
 	if (stored_insert != nullptr)
 	{
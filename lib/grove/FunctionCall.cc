@@ -207,6 +207,7 @@ void FunctionCall::build()
 	}
 
 	auto res = IRBuilder()->CreateCall(getFunction(), llvm_args);
+	res->setCallingConv(getFunction()->getCallingConv());
 	setValue(res);
 }
 
@@ -38,6 +38,19 @@ Genericable* Genericable::findInstance(Type *type) const
 		throw fatal_error("cannot find instance of non-generic");
 	}
 	
+	auto key = getInstanceKey(type);
+	if (key != nullptr)
+	{
+		auto it = m_instance_map.find(key);
+		if (it == m_instance_map.end())
+		{
+			return nullptr;
+		}
+		
+		m_instance_hits++;
+		return it->second;
+	}
+	
 	for (auto instance : m_instances)
 	{
 		auto ty = instance->getType();
@@ -45,6 +58,7 @@ Genericable* Genericable::findInstance(Type *type) const
 		
 		if (ty == type || instance->matchesType(type))
 		{
+			m_instance_hits++;
 			return instance;
 		}
 	}
@@ -55,4 +69,32 @@ Genericable* Genericable::findInstance(Type *type) const
 bool Genericable::hasInstance(Type *type) const
 {
 	return findInstance(type) != nullptr;
+}
+
+void Genericable::addInstance(Genericable *instance, Type *type)
+{
+	assertExists(instance, "Instance cannot be null");
+	
+	m_instances.push_back(instance);
+	
+	auto key = getInstanceKey(type);
+	if (key != nullptr)
+	{
+		m_instance_map[key] = instance;
+	}
+}
+
+Type* Genericable::getInstanceKey(Type *type) const
+{
+	return type;
+}
+
+std::vector<Genericable *> Genericable::getInstances() const
+{
+	return m_instances;
+}
+
+unsigned int Genericable::getInstanceHits() const
+{
+	return m_instance_hits;
 }
\ No newline at end of file
@@ -8,9 +8,13 @@
 
 #include <grove/IDReference.h>
 #include <grove/Valued.h>
+#include <grove/Value.h>
+#include <grove/VarDecl.h>
 #include <grove/Named.h>
 #include <grove/Typed.h>
 
+#include <grove/types/Type.h>
+
 #include <grove/exceptions/undefined_error.h>
 #include <grove/exceptions/fatal_error.h>
 
@@ -26,6 +30,11 @@ bool IDReference::hasPointer() const
 	return findNode()->hasPointer();
 }
 
+unsigned int IDReference::getAlignment() const
+{
+	return findNode()->getAlignment();
+}
+
 Valued* IDReference::findNode() const
 {
 	return m_node;
@@ -36,6 +45,11 @@ OString IDReference::getName() const
 	return m_name;
 }
 
+Valued* IDReference::getNode() const
+{
+	return m_node;
+}
+
 ASTNode* IDReference::copy() const
 {
 	return new IDReference(m_name);
@@ -99,6 +113,47 @@ llvm::Value* IDReference::getSize() const
 	return findNode()->getSize();
 }
 
+bool IDReference::isPure() const
+{
+	return true;
+}
+
+Value* IDReference::fold() const
+{
+	if (m_node == nullptr || m_node->is<VarDecl *>() == false)
+	{
+		return nullptr;
+	}
+	
+	// A constant variable always has the value it was declared with.
+	auto decl = m_node->as<VarDecl *>();
+	auto ty = decl->getType();
+	
+	if (ty->isConst() == false || decl->getExpression() == nullptr ||
+		(ty->isIntTy() == false && ty->isFloatingPointTy() == false &&
+		 ty->isBoolTy() == false))
+	{
+		return nullptr;
+	}
+	
+	auto val = decl->getExpression()->fold();
+	if (val == nullptr)
+	{
+		return nullptr;
+	}
+	
+	auto val_ty = val->getType();
+	if (val_ty->isIntTy() == false && val_ty->isFloatingPointTy() == false &&
+		val_ty->isBoolTy() == false)
+	{
+		delete val;
+		return nullptr;
+	}
+	
+	val->convert(ty);
+	return val;
+}
+
 IDReference::IDReference(OString name)
 {
 	if (name == "")
@@ -7,10 +7,12 @@
 */
 
 #include <grove/IfStmt.h>
+#include <grove/BuiltinExpr.h>
 #include <grove/Function.h>
 #include <grove/CondBlock.h>
 #include <grove/Expression.h>
 #include <grove/Module.h>
+#include <grove/Value.h>
 #include <grove/types/Type.h>
 
 #include <grove/exceptions/fatal_error.h>
@@ -94,6 +96,48 @@ void IfStmt::build()
 	// There will always be m_if_blocks.size() - 1 if checks.
 	// The final if check _may_ not necessarily be a check.
 	
+	// Conditions known at compile time decide which blocks are built. A 
+	// block that's never taken is dropped, and a block that's always taken
+	// is entered unconditionally and drops every block after it.
+	std::vector<Block *> blocks;
+	Block* always_taken = nullptr;
+	
+	for (auto block : getBlocks())
+	{
+		blocks.push_back(block);
+		
+		if (isElse(block))
+		{
+			break;
+		}
+		
+		auto cond = block->as<CondBlock *>();
+		auto folded = cond->getExpression()->fold();
+		
+		if (folded == nullptr)
+		{
+			continue;
+		}
+		
+		bool taken = (folded->getUInt() != 0) != cond->invertCondition();
+		delete folded;
+		
+		if (taken == false)
+		{
+			blocks.pop_back();
+		}
+		else
+		{
+			always_taken = block;
+			break;
+		}
+	}
+	
+	if (blocks.size() == 0)
+	{
+		return;
+	}
+	
 	// First, get our current function.
 	auto parent_func = findParent<Function *>();
 	auto llvm_func = parent_func->getLLVMFunction();
@@ -101,7 +145,7 @@ void IfStmt::build()
 	std::vector<llvm::BasicBlock *> if_checks;
 	
 	// Generate all the if checks first
-	for (unsigned int i = 1; i < getBlocks().size(); i++)
+	for (unsigned int i = 1; i < blocks.size(); i++)
 	{
 		auto bb = llvm::BasicBlock::Create(getModule()->getLLVMContext(),
 										   "if_check", llvm_func,
@@ -110,7 +154,7 @@ void IfStmt::build()
 	}
 	
 	// Now, generate all the bodies.
-	for (unsigned int i = 0; i < getBlocks().size(); i++)
+	for (unsigned int i = 0; i < blocks.size(); i++)
 	{
 		auto bb = llvm::BasicBlock::Create(getModule()->getLLVMContext(),
 										   "if_body", llvm_func,
@@ -135,27 +179,29 @@ void IfStmt::build()
 	}
 
 	// Create all of our if statements.
-	for (unsigned int i = 0; i < getBlocks().size(); i++)
+	for (unsigned int i = 0; i < blocks.size(); i++)
 	{
-		auto block = getBlocks().at(i);
+		auto block = blocks.at(i);
 		auto if_body = getLLVMBlocks().at(i);
 		auto next = if_checks.at(i);
 		
-		if (isElse(block) == false)
+		if (isElse(block) == false && block != always_taken)
 		{
 			auto cond = block->as<CondBlock *>();
 			cond->getExpression()->build();
 			
+			auto weights = BuiltinExpr::getBranchWeights(cond->getExpression());
+			
 			if (cond->invertCondition() == false)
 			{
-    			IRBuilder()->CreateCondBr(getCond(cond), if_body, next);
+    			IRBuilder()->CreateCondBr(getCond(cond), if_body, next, weights);
 			}
 			else
 			{
-    			IRBuilder()->CreateCondBr(getCond(cond), next, if_body);
+    			IRBuilder()->CreateCondBr(getCond(cond), next, if_body, weights);
 			}
 		}
-		else // handle else block
+		else // handle else block, or a block that's always taken
 		{
 			IRBuilder()->CreateBr(if_body);
 		}
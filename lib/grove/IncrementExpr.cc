@@ -88,7 +88,12 @@ void IncrementExpr::build()
     	newVal = IRBuilder()->CreateFAdd(val, delta);
 	}
 	
-	IRBuilder()->CreateStore(newVal, ptr);
+	auto store = IRBuilder()->CreateStore(newVal, ptr);
+	
+	if (getExpression()->getAlignment() != 0)
+	{
+		store->setAlignment(getExpression()->getAlignment());
+	}
 	
 	if (isPreIncrement())
 	{
@@ -0,0 +1,672 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <grove/Interpreter.h>
+#include <grove/ArrayAccessExpr.h>
+#include <grove/ArrayValue.h>
+#include <grove/BinOpAndOr.h>
+#include <grove/BinOpArith.h>
+#include <grove/BinOpAssign.h>
+#include <grove/BinOpCompare.h>
+#include <grove/Block.h>
+#include <grove/CastExpr.h>
+#include <grove/CondBlock.h>
+#include <grove/EnumStmt.h>
+#include <grove/Function.h>
+#include <grove/FunctionCall.h>
+#include <grove/IDReference.h>
+#include <grove/IfStmt.h>
+#include <grove/IncrementExpr.h>
+#include <grove/Loop.h>
+#include <grove/LoopTerminator.h>
+#include <grove/Module.h>
+#include <grove/NegativeExpr.h>
+#include <grove/Parameter.h>
+#include <grove/ReturnStmt.h>
+#include <grove/TernaryExpr.h>
+#include <grove/Value.h>
+#include <grove/VarDecl.h>
+
+#include <grove/types/Type.h>
+#include <grove/types/BoolType.h>
+
+#include <grove/exceptions/code_error.h>
+
+#include <llvm/IR/DerivedTypes.h>
+
+#include <sstream>
+#include <typeinfo>
+
+static bool isScalar(Type* ty)
+{
+	return ty->isIntTy() || ty->isFloatingPointTy() || ty->isBoolTy();
+}
+
+void Interpreter::fail(ASTNode* node, std::string message)
+{
+	throw code_error(node, [message]() -> std::string
+		{
+			return "cannot evaluate at compile time: " + message;
+		});
+}
+
+void Interpreter::step(ASTNode* node)
+{
+	if (++m_steps > m_max_steps)
+	{
+		std::stringstream ss;
+		ss << "gave up after " << m_max_steps << " steps";
+		fail(node, ss.str());
+	}
+}
+
+size_t Interpreter::getCellCount(ASTNode* node, Type* ty)
+{
+	if (ty->isVariadiclySized())
+	{
+		fail(node, "the size of " + ty->getString() + " isn't constant");
+	}
+	
+	if (ty->isArrayTy())
+	{
+		auto llvm_ty = llvm::cast<llvm::ArrayType>(ty->getLLVMType());
+		return llvm_ty->getNumElements() * getCellCount(node, ty->getBaseTy());
+	}
+	
+	if (isScalar(ty) == false)
+	{
+		fail(node, "values of type " + ty->getString() + " aren't supported");
+	}
+	
+	return 1;
+}
+
+void Interpreter::clearFrame(Frame& frame)
+{
+	for (auto& pair : frame)
+	{
+		for (auto cell : pair.second)
+		{
+			delete cell;
+		}
+	}
+	
+	frame.clear();
+}
+
+void Interpreter::declare(VarDecl* decl, Frame& frame)
+{
+	auto ty = decl->getType();
+	Cells cells(getCellCount(decl, ty), nullptr);
+	
+	if (decl->getExpression() != nullptr)
+	{
+		initialize(cells, 0, ty, decl->getExpression());
+	}
+	
+	// A declaration in a loop is run again on every iteration.
+	auto it = frame.find(decl);
+	if (it != frame.end())
+	{
+		for (auto cell : it->second)
+		{
+			delete cell;
+		}
+	}
+	
+	frame[decl] = cells;
+}
+
+void Interpreter::initialize(Cells& cells, size_t offset, Type* ty,
+							 Expression* init)
+{
+	if (ty->isArrayTy() == false)
+	{
+		auto val = evaluate(init);
+	
+		if (val == nullptr || isScalar(val->getType()) == false)
+		{
+			delete val;
+			fail(init, "value isn't a number");
+		}
+	
+		val->convert(ty);
+	
+		delete cells[offset];
+		cells[offset] = val;
+		return;
+	}
+	
+	auto element_ty = ty->getBaseTy();
+	auto stride = getCellCount(init, element_ty);
+	
+	if (init->ASTNode::is<ArrayValue *>())
+	{
+		auto elements = init->ASTNode::as<ArrayValue *>()->getElements();
+		auto count = getCellCount(init, ty) / stride;
+	
+		for (size_t i = 0; i < elements.size() && i < count; i++)
+		{
+			initialize(cells, offset + i * stride, element_ty, elements[i]);
+		}
+	
+		return;
+	}
+	
+	// Copy the elements of another array.
+	auto loc = locate(init);
+	auto count = getCellCount(init, ty);
+	
+	if (getCellCount(init, loc.type) != count)
+	{
+		fail(init, "array sizes don't match");
+	}
+	
+	for (size_t i = 0; i < count; i++)
+	{
+		auto src = loc.cells->at(loc.offset + i);
+	
+		delete cells[offset + i];
+		cells[offset + i] = src ? src->fold() : nullptr;
+	
+		if (cells[offset + i] != nullptr)
+		{
+			cells[offset + i]->convert(element_ty->getRootTy());
+		}
+	}
+}
+
+Interpreter::Location Interpreter::locate(Expression* expr)
+{
+	step(expr);
+	
+	if (expr->ASTNode::is<IDReference *>())
+	{
+		auto ref = expr->ASTNode::as<IDReference *>();
+		auto node = ref->getNode();
+	
+		auto find = [node](Frame& frame) -> Cells*
+		{
+			auto it = frame.find(node);
+			return it == frame.end() ? nullptr : &it->second;
+		};
+	
+		auto cells = find(m_frames.back());
+	
+		if (cells == nullptr)
+		{
+			cells = find(m_globals);
+		}
+	
+		// Constants from outside of the function are evaluated the first
+		// time they're used.
+		if (cells == nullptr && node->is<VarDecl *>() &&
+			node->as<VarDecl *>()->getType()->isConst() &&
+			node->as<VarDecl *>()->getExpression() != nullptr)
+		{
+			declare(node->as<VarDecl *>(), m_globals);
+			cells = find(m_globals);
+		}
+	
+		if (cells == nullptr)
+		{
+			fail(expr, ref->getName().str() + " isn't known until run time");
+		}
+	
+		return Location { cells, 0, ref->getType() };
+	}
+	else if (expr->ASTNode::is<ArrayAccessExpr *>())
+	{
+		auto access = expr->ASTNode::as<ArrayAccessExpr *>();
+		auto loc = locate(access->getArray());
+	
+		if (loc.type->isArrayTy() == false)
+		{
+			fail(access->getArray(), "only arrays can be indexed");
+		}
+	
+		auto index = evaluate(access->getIndex());
+		auto element_ty = loc.type->getBaseTy();
+		auto stride = getCellCount(access, element_ty);
+		auto count = getCellCount(access, loc.type) / stride;
+	
+		bool negative = index->getType()->isSigned() && index->getInt() < 0;
+		auto i = index->getUInt();
+		delete index;
+	
+		if (negative || i >= count)
+		{
+			fail(access->getIndex(), "array index is out of bounds");
+		}
+	
+		return Location { loc.cells, loc.offset + i * stride, element_ty };
+	}
+	
+	fail(expr, "expression can't be assigned to");
+	return Location { nullptr, 0, nullptr };
+}
+
+Value* Interpreter::read(Location loc, Expression* expr)
+{
+	if (loc.type->isArrayTy())
+	{
+		fail(expr, "arrays can only be indexed");
+	}
+	
+	auto cell = loc.cells->at(loc.offset);
+	if (cell == nullptr)
+	{
+		fail(expr, "value is used before it's assigned");
+	}
+	
+	return cell->fold();
+}
+
+void Interpreter::write(Location loc, Value* value)
+{
+	delete loc.cells->at(loc.offset);
+	loc.cells->at(loc.offset) = value;
+}
+
+Value* Interpreter::evaluate(Expression* expr)
+{
+	step(expr);
+	
+	if (expr->ASTNode::is<Value *>())
+	{
+		return expr->fold();
+	}
+	else if (expr->ASTNode::is<IDReference *>() ||
+			 expr->ASTNode::is<ArrayAccessExpr *>())
+	{
+		return read(locate(expr), expr);
+	}
+	else if (expr->ASTNode::is<BinOpAssign *>())
+	{
+		auto assign = expr->ASTNode::as<BinOpAssign *>();
+		auto loc = locate(assign->getLHS());
+	
+		auto rhs = evaluate(assign->getRHS());
+		Value* current = nullptr;
+	
+		if (assign->doesArithmetic())
+		{
+			current = read(loc, assign->getLHS());
+		}
+	
+		auto result = assign->compute(current, rhs);
+		delete current;
+	
+		if (result == nullptr)
+		{
+			delete rhs;
+			fail(assign, "operation would trap or overflow");
+		}
+	
+		write(loc, result);
+	
+		// Like at run time, the value of an assignment is its RHS.
+		return rhs;
+	}
+	else if (expr->ASTNode::is<IncrementExpr *>())
+	{
+		auto inc = expr->ASTNode::as<IncrementExpr *>();
+		auto loc = locate(inc->getExpression());
+		auto ty = inc->getType();
+	
+		auto old = read(loc, inc->getExpression());
+		auto delta = Value::fromInt(inc->getDelta(), ty);
+		auto updated = BinOpArith::compute("+", old, delta, ty,
+										   ty->isSigned());
+		delete delta;
+	
+		write(loc, updated);
+	
+		if (inc->isPreIncrement())
+		{
+			delete old;
+			return updated->fold();
+		}
+	
+		return old;
+	}
+	else if (expr->ASTNode::is<BinOpArith *>())
+	{
+		auto arith = expr->ASTNode::as<BinOpArith *>();
+		auto lhs = evaluate(arith->getLHS());
+		auto rhs = evaluate(arith->getRHS());
+	
+		auto result = arith->compute(lhs, rhs);
+		delete lhs;
+		delete rhs;
+	
+		if (result == nullptr)
+		{
+			fail(arith, "operation would trap or overflow");
+		}
+	
+		return result;
+	}
+	else if (expr->ASTNode::is<BinOpCompare *>())
+	{
+		auto cmp = expr->ASTNode::as<BinOpCompare *>();
+		auto lhs = evaluate(cmp->getLHS());
+		auto rhs = evaluate(cmp->getRHS());
+	
+		auto result = cmp->compute(lhs, rhs);
+		delete lhs;
+		delete rhs;
+	
+		if (result == nullptr)
+		{
+			fail(cmp, "only numbers can be compared");
+		}
+	
+		return result;
+	}
+	else if (expr->ASTNode::is<BinOpAndOr *>())
+	{
+		auto andor = expr->ASTNode::as<BinOpAndOr *>();
+		bool lhs = evaluateCondition(andor->getLHS());
+	
+		// The RHS is only evaluated if the LHS doesn't decide the result.
+		bool result = lhs;
+		if (lhs == (andor->getOperator() == "&&"))
+		{
+			result = evaluateCondition(andor->getRHS());
+		}
+	
+		return Value::fromUInt(result, BoolType::get());
+	}
+	else if (expr->ASTNode::is<CastExpr *>())
+	{
+		auto cast = expr->ASTNode::as<CastExpr *>();
+	
+		if (isScalar(cast->getType()) == false)
+		{
+			fail(cast, "can't cast to " + cast->getType()->getString());
+		}
+	
+		auto val = evaluate(cast->getExpression());
+		val->convert(cast->getType());
+		return val;
+	}
+	else if (expr->ASTNode::is<NegativeExpr *>())
+	{
+		auto val = evaluate(expr->ASTNode::as<NegativeExpr *>()
+							->getExpression());
+		val->negate();
+		return val;
+	}
+	else if (expr->ASTNode::is<TernaryExpr *>())
+	{
+		auto ternary = expr->ASTNode::as<TernaryExpr *>();
+	
+		auto val = evaluateCondition(ternary->getCondition()) ?
+			evaluate(ternary->getTrueVal()) : evaluate(ternary->getFalseVal());
+		val->convert(ternary->getType());
+		return val;
+	}
+	else if (expr->ASTNode::is<FunctionCall *>())
+	{
+		auto call = expr->ASTNode::as<FunctionCall *>();
+		auto node = call->getNode();
+	
+		if (node->is<Function *>() == false)
+		{
+			fail(call, call->getName().str() + " can only be called at "
+				 "run time");
+		}
+	
+		std::vector<Value *> args;
+		for (auto arg : call->getArgs())
+		{
+			args.push_back(evaluate(arg));
+		}
+	
+		return this->call(node->as<Function *>(), args, call);
+	}
+	
+	// Anything else has to be a constant, such as sizeof or an enum member.
+	auto val = expr->fold();
+	
+	if (val == nullptr)
+	{
+		fail(expr, "expression isn't supported");
+	}
+	
+	return val;
+}
+
+bool Interpreter::evaluateCondition(Expression* expr)
+{
+	auto val = evaluate(expr);
+	
+	if (val == nullptr || isScalar(val->getType()) == false)
+	{
+		fail(expr, "condition isn't a number");
+	}
+	
+	val->convert(BoolType::get());
+	bool result = val->getUInt() != 0;
+	
+	delete val;
+	return result;
+}
+
+Interpreter::Control Interpreter::execute(ASTNode* stmt)
+{
+	step(stmt);
+	
+	if (stmt->is<VarDecl *>())
+	{
+		declare(stmt->as<VarDecl *>(), m_frames.back());
+		return CONTROL_NEXT;
+	}
+	else if (stmt->is<ReturnStmt *>())
+	{
+		auto ret = stmt->as<ReturnStmt *>();
+	
+		delete m_return;
+		m_return = ret->hasExpression() ? evaluate(ret->getExpression()) :
+			nullptr;
+	
+		return CONTROL_RETURN;
+	}
+	else if (stmt->is<LoopTerminator *>())
+	{
+		if (stmt->as<LoopTerminator *>()->getTerminatorStr() == "break")
+		{
+			return CONTROL_BREAK;
+		}
+	
+		return CONTROL_CONTINUE;
+	}
+	else if (stmt->is<IfStmt *>())
+	{
+		return executeIf(stmt->as<IfStmt *>());
+	}
+	else if (stmt->is<Loop *>())
+	{
+		return executeLoop(stmt->as<Loop *>());
+	}
+	else if (stmt->is<Function *>() || stmt->is<EnumStmt *>())
+	{
+		// Declarations don't do anything when they're run.
+		return CONTROL_NEXT;
+	}
+	else if (stmt->is<Expression *>())
+	{
+		delete evaluate(stmt->as<Expression *>());
+		return CONTROL_NEXT;
+	}
+	else if (typeid(*stmt) == typeid(Block))
+	{
+		return executeBlock(stmt->as<Block *>());
+	}
+	
+	fail(stmt, "statement isn't supported");
+	return CONTROL_NEXT;
+}
+
+Interpreter::Control Interpreter::executeBlock(Block* block)
+{
+	for (auto stmt : block->getStatements())
+	{
+		auto control = execute(stmt);
+	
+		if (control != CONTROL_NEXT)
+		{
+			return control;
+		}
+	}
+	
+	return CONTROL_NEXT;
+}
+
+Interpreter::Control Interpreter::executeIf(IfStmt* stmt)
+{
+	for (auto block : stmt->getBlocks())
+	{
+		if (block->is<CondBlock *>())
+		{
+			auto cond = block->as<CondBlock *>();
+			bool taken = evaluateCondition(cond->getExpression()) !=
+				cond->invertCondition();
+	
+			if (taken == false)
+			{
+				continue;
+			}
+		}
+	
+		return executeBlock(block);
+	}
+	
+	return CONTROL_NEXT;
+}
+
+Interpreter::Control Interpreter::executeLoop(Loop* loop)
+{
+	for (auto initializer : loop->getInitializers())
+	{
+		execute(initializer);
+	}
+	
+	auto check = [this, loop]() -> bool
+	{
+		return loop->getCondition() == nullptr ||
+			evaluateCondition(loop->getCondition());
+	};
+	
+	if (loop->isPostCheck() == false && check() == false)
+	{
+		return CONTROL_NEXT;
+	}
+	
+	while (true)
+	{
+		step(loop);
+	
+		auto control = executeBlock(loop);
+	
+		if (control == CONTROL_RETURN)
+		{
+			return CONTROL_RETURN;
+		}
+		else if (control == CONTROL_BREAK)
+		{
+			break;
+		}
+	
+		if (loop->getAfterthought() != nullptr)
+		{
+			execute(loop->getAfterthought());
+		}
+	
+		if (check() == false)
+		{
+			break;
+		}
+	}
+	
+	return CONTROL_NEXT;
+}
+
+Value* Interpreter::call(Function* func, std::vector<Value *> args,
+						 ASTNode* site)
+{
+	if (m_frames.size() >= m_max_depth)
+	{
+		for (auto arg : args)
+		{
+			delete arg;
+		}
+	
+		fail(site, "calls are nested too deeply");
+	}
+	
+	// The body of the function might not have been resolved yet.
+	if (m_resolved.insert(func).second)
+	{
+		func->getModule()->resolve(func);
+	}
+	
+	Frame frame;
+	auto params = func->getParams();
+	
+	for (unsigned int i = 0; i < params.size(); i++)
+	{
+		auto ty = params[i]->getType();
+	
+		if (isScalar(ty) == false || args[i] == nullptr ||
+			isScalar(args[i]->getType()) == false)
+		{
+			fail(params[i], "values of type " + ty->getString() +
+				 " can't be passed");
+		}
+	
+		args[i]->convert(ty);
+		frame[params[i]] = Cells(1, args[i]);
+	}
+	
+	m_frames.push_back(frame);
+	
+	auto control = executeBlock(func);
+	
+	clearFrame(m_frames.back());
+	m_frames.pop_back();
+	
+	auto result = m_return;
+	m_return = nullptr;
+	
+	if (func->isVoidFunction())
+	{
+		delete result;
+		return nullptr;
+	}
+	
+	if (control != CONTROL_RETURN || result == nullptr)
+	{
+		fail(func, "function ended without returning a value");
+	}
+	
+	result->convert(func->getReturnType());
+	return result;
+}
+
+Interpreter::~Interpreter()
+{
+	for (auto& frame : m_frames)
+	{
+		clearFrame(frame);
+	}
+	
+	clearFrame(m_globals);
+	delete m_return;
+}
@@ -11,6 +11,16 @@
 #include <grove/Function.h>
 #include <grove/Module.h>
 #include <grove/ReturnStmt.h>
+#include <grove/VarDecl.h>
+#include <grove/Value.h>
+#include <grove/BinOpAssign.h>
+#include <grove/BuiltinExpr.h>
+#include <grove/BinOpCompare.h>
+#include <grove/IDReference.h>
+#include <grove/FunctionCall.h>
+#include <grove/IncrementExpr.h>
+#include <grove/ReferenceExpr.h>
+#include <grove/Parameter.h>
 
 #include <grove/types/Type.h>
 
@@ -20,6 +30,11 @@
 #include <util/copy.h>
 
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Metadata.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/CFG.h>
 
 ASTNode* Loop::copyIfNonNull(ASTNode *node) const
 {
@@ -40,6 +55,12 @@ ASTNode* Loop::copy() const
 	
 	auto loop = new Loop(initializers, condition, afterthought, m_post_check);
 	loop->copyStatements(this);
+	
+	loop->m_vectorize_width = m_vectorize_width;
+	loop->m_unroll_count = m_unroll_count;
+	loop->m_interleave_count = m_interleave_count;
+	loop->m_assert_vectorized = m_assert_vectorized;
+	
 	return loop;
 }
 
@@ -83,6 +104,453 @@ bool Loop::isPostCheck() const
 	return m_post_check;
 }
 
+/// Indicates whether node is assigned to or incremented anywhere under root,
+/// or has its address taken there.
+static bool isChangedIn(ASTNode* root, Valued* node)
+{
+	for (auto ref : root->findChildren<IDReference *>())
+	{
+		if (ref->getNode() != node)
+		{
+			continue;
+		}
+		
+		auto parent = ref->getParent();
+		if (parent->is<IncrementExpr *>() || parent->is<ReferenceExpr *>())
+		{
+			return true;
+		}
+		
+		if (parent->is<BinOpAssign *>() &&
+			parent->as<BinOpAssign *>()->getLHS() == ref)
+		{
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+/// Indicates whether the address of node is taken anywhere under root.
+static bool isAddressTakenIn(ASTNode* root, Valued* node)
+{
+	for (auto ref : root->findChildren<IDReference *>())
+	{
+		if (ref->getNode() == node && ref->getParent()->is<ReferenceExpr *>())
+		{
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+/// Indicates whether node is declared in func and only used there, so a
+/// call from func can't change it.
+static bool isLocalTo(Function* func, Valued* node)
+{
+	if (node->as<ASTNode *>()->findParent<Function *>() != func)
+	{
+		return false;
+	}
+	
+	for (auto ref : func->findChildren<IDReference *>())
+	{
+		if (ref->getNode() == node && ref->findParent<Function *>() != func)
+		{
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+VarDecl* Loop::getInductionVar() const
+{
+	if (isPostCheck() || getInitializers().size() != 1 ||
+		getInitializers()[0]->is<VarDecl *>() == false ||
+		getCondition() == nullptr || getAfterthought() == nullptr)
+	{
+		return nullptr;
+	}
+	
+	auto decl = getInitializers()[0]->as<VarDecl *>();
+	if (decl->getType()->isIntTy() == false)
+	{
+		return nullptr;
+	}
+	
+	auto isDecl = [decl](Expression* expr) -> bool
+	{
+		return expr->ASTNode::is<IDReference *>() &&
+			expr->ASTNode::as<IDReference *>()->getNode() == (Valued *)decl;
+	};
+	
+	if (getCondition()->ASTNode::is<BinOpCompare *>() == false)
+	{
+		return nullptr;
+	}
+	
+	auto cond = getCondition()->ASTNode::as<BinOpCompare *>();
+	if ((cond->getOperator() != "<" && cond->getOperator() != "<=") ||
+		isDecl(cond->getLHS()) == false ||
+		cond->getRHS()->getType()->isIntTy() == false)
+	{
+		return nullptr;
+	}
+	
+	if (getAfterthought()->is<IncrementExpr *>() == false ||
+		getAfterthought()->as<IncrementExpr *>()->getDelta() != 1 ||
+		isDecl(getAfterthought()->as<IncrementExpr *>()->getExpression()) ==
+		false)
+	{
+		return nullptr;
+	}
+	
+	// The bound has to be the same on every iteration.
+	auto bound = cond->getRHS();
+	if (bound->ASTNode::is<IDReference *>())
+	{
+		auto node = bound->ASTNode::as<IDReference *>()->getNode();
+		
+		if (node->is<VarDecl *>() == false && node->is<Parameter *>() == false)
+		{
+			return nullptr;
+		}
+		
+		if (isAddressTakenIn(getModule()->getMain(), node))
+		{
+			return nullptr;
+		}
+		
+		for (auto parent = node->as<ASTNode *>()->getParent(); parent != nullptr;
+			 parent = parent->getParent())
+		{
+			if (parent == this)
+			{
+				return nullptr;
+			}
+		}
+		
+		bool calls = false;
+		
+		for (auto stmt : getStatements())
+		{
+			if (isChangedIn(stmt, node))
+			{
+				return nullptr;
+			}
+			
+			calls = calls || stmt->is<FunctionCall *>() ||
+				stmt->findChildren<FunctionCall *>().size() > 0;
+		}
+		
+		// A called function may change the bound if it can see it.
+		if (calls && isLocalTo(findParent<Function *>(), node) == false)
+		{
+			return nullptr;
+		}
+	}
+	else if (bound->ASTNode::is<Value *>() == false)
+	{
+		return nullptr;
+	}
+	
+	for (auto stmt : getStatements())
+	{
+		if (isChangedIn(stmt, decl))
+		{
+			return nullptr;
+		}
+	}
+	
+	return decl;
+}
+
+bool Loop::runsEveryIteration(const ASTNode* stmt) const
+{
+	for (auto other : getStatements())
+	{
+		// Statements that aren't expressions or declarations may not run,
+		// or may skip what comes after them.
+		if (other->is<Expression *>() == false &&
+			other->is<VarDecl *>() == false)
+		{
+			return false;
+		}
+		
+		if (other == stmt)
+		{
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+void Loop::addRangeCheck(llvm::Value* size)
+{
+	auto decl = getInductionVar();
+	assertExists(decl, "Loop has no induction variable");
+	
+	auto cond = getCondition()->ASTNode::as<BinOpCompare *>();
+	auto bound = cond->getRHS();
+	
+	// Build the check right before the loop is entered.
+	LLVMBuilder builder(m_entry_branch);
+	auto i64 = builder.getInt64Ty();
+	
+	auto start = builder.CreateIntCast(builder.CreateLoad(decl->getPointer()),
+									   i64, decl->getType()->isSigned());
+	
+	llvm::Value* end = nullptr;
+	if (bound->ASTNode::is<IDReference *>())
+	{
+		auto node = bound->ASTNode::as<IDReference *>()->getNode();
+		end = builder.CreateLoad(node->getPointer());
+	}
+	else
+	{
+		end = bound->getValue();
+	}
+	
+	end = builder.CreateIntCast(end, i64, bound->getType()->isSigned());
+	
+	llvm::Value* empty = nullptr;
+	llvm::Value* fits = nullptr;
+	
+	if (cond->getOperator() == "<")
+	{
+		empty = builder.CreateICmpSGE(start, end);
+		fits = builder.CreateICmpSLE(end, size);
+	}
+	else
+	{
+		empty = builder.CreateICmpSGT(start, end);
+		fits = builder.CreateICmpSLT(end, size);
+	}
+	
+	auto positive = builder.CreateICmpSGE(start, builder.getInt64(0));
+	auto ok = builder.CreateOr(empty, builder.CreateAnd(positive, fits));
+	
+	if (m_range_ok != nullptr)
+	{
+		ok = builder.CreateAnd(m_range_ok, ok);
+	}
+	
+	m_range_ok = ok;
+	
+	if (m_entry_branch->isConditional())
+	{
+		m_entry_branch->setCondition(m_range_ok);
+		return;
+	}
+	
+	auto trap = findParent<Function *>()->getTrapBlock();
+	auto branch = builder.CreateCondBr(m_range_ok,
+									   m_entry_branch->getSuccessor(0), trap);
+	
+	m_entry_branch->eraseFromParent();
+	m_entry_branch = branch;
+}
+
+bool Loop::hasVariadicDecls() const
+{
+	auto func = findParent<Function *>();
+	
+	for (auto stmt : getStatements())
+	{
+		auto decls = stmt->findChildren<VarDecl *>();
+		
+		if (stmt->is<VarDecl *>())
+		{
+			decls.push_back(stmt->as<VarDecl *>());
+		}
+		
+		for (auto decl : decls)
+		{
+			// Declarations in nested loops or functions are handled there.
+			if (decl->findParent<Loop *>() != this ||
+				decl->findParent<Function *>() != func)
+			{
+				continue;
+			}
+			
+			if (decl->getType()->isVariadiclySized())
+			{
+				return true;
+			}
+		}
+	}
+	
+	return false;
+}
+
+void Loop::restoreStack()
+{
+	if (m_stack == nullptr)
+	{
+		return;
+	}
+	
+	auto restore = llvm::Intrinsic::getDeclaration(getModule()->getLLVMModule(),
+		llvm::Intrinsic::stackrestore);
+	IRBuilder()->CreateCall(restore, m_stack);
+}
+
+bool Loop::hasHints() const
+{
+	return m_vectorize_width != 0 || m_unroll_count != 0 ||
+		m_interleave_count != 0 || m_assert_vectorized;
+}
+
+void Loop::addHint(OString name, Value* value)
+{
+	if (name == "assert_vectorized")
+	{
+		if (value != nullptr)
+		{
+			throw code_error(value, []() -> std::string
+				{
+					return "assert_vectorized does not take a value";
+				});
+		}
+		
+		m_assert_vectorized = true;
+		checkAssertVectorized(&name);
+		return;
+	}
+	
+	unsigned int* hint = nullptr;
+	
+	if (name == "vectorize")
+	{
+		hint = &m_vectorize_width;
+	}
+	else if (name == "unroll")
+	{
+		hint = &m_unroll_count;
+	}
+	else if (name == "interleave")
+	{
+		hint = &m_interleave_count;
+	}
+	else
+	{
+		throw code_error(&name, [name]() -> std::string
+			{
+				std::stringstream ss;
+				ss << "unknown loop hint " << name.str();
+				return ss.str();
+			});
+	}
+	
+	if (value == nullptr)
+	{
+		throw code_error(&name, [name]() -> std::string
+			{
+				std::stringstream ss;
+				ss << "loop hint " << name.str() << " requires a value";
+				return ss.str();
+			});
+	}
+	
+	if (value->getType()->isIntTy() == false || value->getInt() <= 0)
+	{
+		throw code_error(value, [name]() -> std::string
+			{
+				std::stringstream ss;
+				ss << "value of loop hint " << name.str()
+				   << " must be a positive integer";
+				return ss.str();
+			});
+	}
+	
+	*hint = (unsigned int)value->getInt();
+	checkAssertVectorized(value);
+}
+
+void Loop::checkAssertVectorized(CodeBase* element) const
+{
+	// The vectorizer marks a loop it vectorized by setting its width to 1,
+	// so a loop asking for a width of 1 would always look vectorized.
+	if (m_assert_vectorized && m_vectorize_width == 1)
+	{
+		throw code_error(element, []() -> std::string
+			{
+				return "assert_vectorized can't be used with vectorize(1)";
+			});
+	}
+}
+
+llvm::MDNode* Loop::createLoopID() const
+{
+	if (hasHints() == false)
+	{
+		return nullptr;
+	}
+	
+	auto& ctx = getModule()->getLLVMContext();
+	auto i32 = llvm::Type::getInt32Ty(ctx);
+	
+	auto createHint = [&ctx, i32](std::string name, unsigned int value)
+	{
+		llvm::Metadata* vals[] = {
+			llvm::MDString::get(ctx, name),
+			llvm::ConstantAsMetadata::get(llvm::ConstantInt::get(i32, value))
+		};
+		
+		return llvm::MDNode::get(ctx, vals);
+	};
+	
+	// Reserve the first operand for the loop ID to refer to itself.
+	auto temp = llvm::MDNode::getTemporary(ctx, llvm::None);
+	
+	llvm::SmallVector<llvm::Metadata *, 4> args;
+	args.push_back(temp);
+	
+	if (m_vectorize_width != 0)
+	{
+		args.push_back(createHint("llvm.loop.vectorize.width",
+								  m_vectorize_width));
+		args.push_back(createHint("llvm.loop.vectorize.enable",
+								  m_vectorize_width > 1));
+	}
+	
+	if (m_interleave_count != 0)
+	{
+		args.push_back(createHint("llvm.loop.interleave.count",
+								  m_interleave_count));
+	}
+	
+	if (m_unroll_count != 0)
+	{
+		args.push_back(createHint("llvm.loop.unroll.count", m_unroll_count));
+	}
+	
+	if (m_assert_vectorized)
+	{
+		// The loop vectorizer keeps unknown operands when it marks a loop
+		// as vectorized, so the assertion can be checked after optimizing.
+		std::stringstream loc;
+		loc << getLocation().file << ":" << getLocation().first_line << ":"
+		    << getLocation().first_column;
+		
+		llvm::Metadata* vals[] = {
+			llvm::MDString::get(ctx, LOOP_ASSERT_VECTORIZED),
+			llvm::MDString::get(ctx, loc.str())
+		};
+		
+		args.push_back(llvm::MDNode::get(ctx, vals));
+	}
+	
+	auto loop_id = llvm::MDNode::get(ctx, args);
+	loop_id->replaceOperandWith(0, loop_id);
+	llvm::MDNode::deleteTemporary(temp);
+	
+	return loop_id;
+}
+
 void Loop::resolve()
 {
 	if (getCondition() != nullptr)
@@ -146,15 +614,20 @@ void Loop::build()
 	
 	// If we're a pre-check and have a condition, go to the condition.
 	// Otherwise, go to our body.
+	llvm::BasicBlock* header = nullptr;
+	
 	if (isPostCheck() == false && getCondition())
 	{
-		IRBuilder()->CreateBr(getConditionBlock());
+		header = getConditionBlock();
 	}
 	else
 	{
-		IRBuilder()->CreateBr(getBodyBlock());
+		header = getBodyBlock();
 	}
 	
+	m_entry_branch = IRBuilder()->CreateBr(header);
+	m_range_ok = nullptr;
+	
 	// Next, we'll create the condition section.
 	if (getCondition())
 	{
@@ -166,17 +639,28 @@ void Loop::build()
 	
 		// continue_block will always be non-null when there's a condition.
 		IRBuilder()->CreateCondBr(vCondition, getBodyBlock(),
-								  getContinueBlock());
+								  getContinueBlock(),
+								  BuiltinExpr::getBranchWeights(getCondition()));
 	}
 	
 	// Next, we'll generate our body.
 	IRBuilder()->SetInsertPoint(getBodyBlock());
+	
+	if (hasVariadicDecls())
+	{
+		auto save = llvm::Intrinsic::getDeclaration(
+			getModule()->getLLVMModule(), llvm::Intrinsic::stacksave);
+		m_stack = IRBuilder()->CreateCall(save);
+	}
+	
 	buildStatements();
 	
 	// If we're not a terminator, go to either our m_afterthought block
 	// or our body block, depending on which exists.
 	if (Block::isTerminator() == false)
 	{
+		restoreStack();
+		
 		if (getAfterthoughtBlock() != nullptr)
 		{
 			IRBuilder()->CreateBr(getAfterthoughtBlock());
@@ -207,6 +691,23 @@ void Loop::build()
 		}
 	}
 	
+	// Every branch back to the header is a latch; they all need the same
+	// loop ID for LLVM to see the hints.
+	auto loop_id = createLoopID();
+	if (loop_id != nullptr)
+	{
+		for (auto it = llvm::pred_begin(header); it != llvm::pred_end(header);
+			 it++)
+		{
+			auto term = (*it)->getTerminator();
+			
+			if (term != m_entry_branch)
+			{
+				term->setMetadata("llvm.loop", loop_id);
+			}
+		}
+	}
+	
 	if (isTerminator() == false)
 	{
 		IRBuilder()->SetInsertPoint(getContinueBlock());
@@ -39,6 +39,7 @@ void LoopTerminator::resolve()
 void LoopTerminator::build()
 {
 	auto parent_loop = findParent<Loop *>();
+	parent_loop->restoreStack();
 	
 	if (getTerminatorStr() == "break")
 	{
@@ -25,6 +25,11 @@ void MainFunction::setupFunction()
 	IRBuilder()->CreateStore(default_ret, getRetValue());
 }
 
+bool MainFunction::isExported() const
+{
+	return true;
+}
+
 MainFunction::MainFunction(Module* mod, OString name)
 : Function(mod, name, std::vector<Parameter *>())
 {
@@ -7,11 +7,16 @@
 */
 
 #include <stdexcept>
+#include <iostream>
+#include <sstream>
+#include <cctype>
 
 #include <grove/Module.h>
 #include <grove/Namespace.h>
 #include <grove/Builder.h>
+#include <grove/BuildSettings.h>
 #include <grove/MainFunction.h>
+#include <grove/Loop.h>
 
 #include <grove/types/FunctionType.h>
 #include <grove/types/IntType.h>
@@ -27,12 +32,21 @@
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Support/FormattedStream.h>
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/ADT/SmallString.h>
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/Target/TargetSubtargetInfo.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/Analysis/Passes.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Transforms/Scalar.h>
+#include <llvm/Transforms/IPO.h>
+#include <llvm/Transforms/Vectorize.h>
+#include <llvm/IR/Metadata.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/Bitcode/ReaderWriter.h>
+#include <llvm/Transforms/Utils/Cloning.h>
 
 llvm::Module* Module::getLLVMModule() const
 {
@@ -49,11 +63,211 @@ llvm::LLVMContext& Module::getLLVMContext() const
 	return llvm::getGlobalContext();
 }
 
+llvm::GlobalVariable* Module::getStringConstant(std::string str)
+{
+	auto it = m_strings.find(str);
+	if (it != m_strings.end())
+	{
+		return it->second;
+	}
+	
+	auto data = llvm::ConstantDataArray::getString(getLLVMContext(), str);
+	auto global = new llvm::GlobalVariable(*m_llvm_module, data->getType(),
+		true, llvm::GlobalValue::PrivateLinkage, data, ".str");
+	
+	// Nothing compares the addresses of string literals, so identical ones
+	// can be merged into one copy.
+	global->setUnnamedAddr(true);
+	global->setAlignment(1);
+	
+	m_strings[str] = global;
+	return global;
+}
+
+void Module::addProfileCounters(llvm::Function* func, uint64_t hash,
+								llvm::GlobalVariable* counters)
+{
+	auto& ctx = getLLVMContext();
+	auto i8p = llvm::Type::getInt8PtrTy(ctx);
+	auto i64 = llvm::Type::getInt64Ty(ctx);
+	auto counters_ty = llvm::cast<llvm::ArrayType>(
+		counters->getType()->getElementType());
+	
+	llvm::Constant* fields[] = {
+		llvm::ConstantExpr::getBitCast(
+			getStringConstant(func->getName().str()), i8p),
+		llvm::ConstantInt::get(i64, hash),
+		llvm::ConstantInt::get(i64, counters_ty->getNumElements()),
+		llvm::ConstantExpr::getBitCast(counters, i64->getPointerTo())
+	};
+	
+	m_profile_records.push_back(llvm::ConstantStruct::getAnon(fields));
+}
+
+llvm::Function* Module::getProfileWriter()
+{
+	if (m_profile_writer != nullptr)
+	{
+		return m_profile_writer;
+	}
+	
+	// Declared now and defined once every function has been built; a
+	// declaration must be external until then.
+	auto ty = llvm::FunctionType::get(llvm::Type::getVoidTy(getLLVMContext()),
+									  false);
+	m_profile_writer = llvm::Function::Create(ty,
+		llvm::GlobalValue::ExternalLinkage, "orange.profile.write",
+		m_llvm_module);
+	
+	return m_profile_writer;
+}
+
+void Module::defineProfileWriter()
+{
+	if (m_profile_writer == nullptr)
+	{
+		return;
+	}
+	
+	auto& ctx = getLLVMContext();
+	auto i64 = llvm::Type::getInt64Ty(ctx);
+	
+	llvm::Type* fields[] = { llvm::Type::getInt8PtrTy(ctx), i64, i64,
+		i64->getPointerTo() };
+	auto record_ty = llvm::StructType::get(ctx, fields);
+	auto records_ty = llvm::ArrayType::get(record_ty,
+										   m_profile_records.size());
+	
+	auto records = new llvm::GlobalVariable(*m_llvm_module, records_ty, true,
+		llvm::GlobalValue::PrivateLinkage,
+		llvm::ConstantArray::get(records_ty, m_profile_records),
+		"orange.profile.records");
+	
+	llvm::Type* params[] = { record_ty->getPointerTo(), i64 };
+	auto runtime_ty = llvm::FunctionType::get(llvm::Type::getVoidTy(ctx),
+											  params, false);
+	auto runtime = m_llvm_module->getOrInsertFunction("orange_profile_write",
+													  runtime_ty);
+	
+	auto block = llvm::BasicBlock::Create(ctx, "entry", m_profile_writer);
+	llvm::IRBuilder<> builder(block);
+	
+	llvm::Value* args[] = {
+		builder.CreateConstInBoundsGEP2_64(records, 0, 0),
+		builder.getInt64(m_profile_records.size())
+	};
+	
+	builder.CreateCall(runtime, args);
+	builder.CreateRetVoid();
+	
+	m_profile_writer->setLinkage(llvm::GlobalValue::InternalLinkage);
+}
+
+void Module::orderFunctions()
+{
+	auto& funcs = m_llvm_module->getFunctionList();
+	
+	std::vector<llvm::Function *> hot;
+	std::vector<llvm::Function *> cold;
+	
+	for (auto& func : funcs)
+	{
+		if (func.isDeclaration())
+		{
+			continue;
+		}
+		
+		if (func.hasFnAttribute(llvm::Attribute::InlineHint))
+		{
+			hot.push_back(&func);
+		}
+		else if (func.hasFnAttribute(llvm::Attribute::Cold))
+		{
+			cold.push_back(&func);
+		}
+	}
+	
+	// Functions are emitted in the order they appear in the module.
+	for (auto it = hot.rbegin(); it != hot.rend(); it++)
+	{
+		(*it)->removeFromParent();
+		funcs.push_front(*it);
+	}
+	
+	for (auto func : cold)
+	{
+		func->removeFromParent();
+		funcs.push_back(func);
+	}
+}
+
 std::string Module::getFile() const
 {
 	return m_file;
 }
 
+std::string Module::getMangledName() const
+{
+	// The absolute path tells apart modules with the same file name in
+	// different directories.
+	llvm::SmallString<128> path(m_file);
+	llvm::sys::fs::make_absolute(path);
+	llvm::sys::path::replace_extension(path, "");
+	
+	std::vector<std::string> parts;
+	
+	for (auto it = llvm::sys::path::begin(path);
+		 it != llvm::sys::path::end(path); ++it)
+	{
+		auto part = it->str();
+		
+		if (part == "..")
+		{
+			if (parts.empty() == false)
+			{
+				parts.pop_back();
+			}
+		}
+		else if (part != "." && llvm::sys::path::is_separator(part[0]) == false)
+		{
+			parts.push_back(part);
+		}
+	}
+	
+	const char* hex = "0123456789abcdef";
+	
+	std::stringstream ss;
+	ss << "N";
+	
+	for (auto part : parts)
+	{
+		// Characters that can't be in an identifier are written as $ and
+		// their value, so different paths never give the same name.
+		std::string escaped;
+		
+		for (auto c : part)
+		{
+			auto uc = (unsigned char)c;
+			
+			if (std::isalnum(uc) || c == '_')
+			{
+				escaped += c;
+			}
+			else
+			{
+				escaped += '$';
+				escaped += hex[uc >> 4];
+				escaped += hex[uc & 0xf];
+			}
+		}
+		
+		ss << escaped.size() << escaped;
+	}
+	
+	ss << "E";
+	return ss.str();
+}
+
 Builder* Module::getBuilder() const
 {
 	return m_builder;
@@ -142,12 +356,8 @@ void Module::findDependencies(ASTNode *node)
 	}
 
 	// Find the dependencies of this node after searching all the children.
-	auto it = std::find(this->m_searched.begin(), this->m_searched.end(),
-						node);
-
-	if (it == std::end(this->m_searched))
+	if (this->m_searched.insert(node).second)
 	{
-		this->m_searched.push_back(node);
 		node->findDependencies();
 	}
 }
@@ -166,12 +376,8 @@ void Module::resolveDependencies(ASTNode *node)
 	}
 
 	// Resolve this node after resolving the dependencies.
-	auto it = std::find(this->m_resolved.begin(), this->m_resolved.end(),
-						node);
-
-	if (it == std::end(this->m_resolved))
+	if (this->m_resolved.insert(node).second)
 	{
-		this->m_resolved.push_back(node);
 		node->resolve();
 	}
 }
@@ -198,13 +404,51 @@ void Module::resolve()
 	resolve(getMain());
 }
 
+void Module::optimizeFunction(llvm::Function* func)
+{
+	llvm::legacy::FunctionPassManager FPM(m_llvm_module);
+	FPM.add(llvm::createVerifierPass(true));
+	FPM.add(llvm::createBasicAliasAnalysisPass());
+	FPM.add(llvm::createPromoteMemoryToRegisterPass());
+	FPM.add(llvm::createInstructionCombiningPass());
+	FPM.add(llvm::createReassociatePass());
+	FPM.add(llvm::createGVNPass());
+	FPM.add(llvm::createCFGSimplificationPass());
+	
+	// Turns self-recursive calls in tail position into loops and marks the
+	// other calls in tail position that can reuse the stack frame.
+	FPM.add(llvm::createTailCallEliminationPass());
+	
+	FPM.run(*func);
+}
+
 void Module::build()
 {
 	getMain()->build();
+	defineProfileWriter();
+	
+	// Functions weren't optimized as they were built; copy the code before
+	// they are.
+	if (getBuilder()->getSettings()->getEmitUnoptimized())
+	{
+		m_unoptimized = llvm::CloneModule(m_llvm_module);
+		
+		for (auto& func : *m_llvm_module)
+		{
+			if (func.isDeclaration() == false)
+			{
+				optimizeFunction(&func);
+			}
+		}
+	}
 	
 	// Optimize the module 
 	llvm::legacy::PassManager MPM;
 	
+	// The loop passes need the data layout and the target's cost model.
+	MPM.add(new llvm::DataLayoutPass());
+	getBuilder()->getTargetMachine()->addAnalysisPasses(MPM);
+	
 	MPM.add(llvm::createVerifierPass(true));
 	MPM.add(llvm::createBasicAliasAnalysisPass());
 	MPM.add(llvm::createPromoteMemoryToRegisterPass());
@@ -212,20 +456,97 @@ void Module::build()
 	MPM.add(llvm::createReassociatePass());
 	MPM.add(llvm::createGVNPass());
 	MPM.add(llvm::createCFGSimplificationPass());
+	
+	// Functions that aren't exported have internal linkage, so once they've
+	// been inlined into every caller they can be removed.
+	MPM.add(llvm::createFunctionInliningPass(
+		getBuilder()->getSettings()->getInlineThreshold()));
+	MPM.add(llvm::createGlobalDCEPass());
+	MPM.add(llvm::createInstructionCombiningPass());
+	MPM.add(llvm::createGVNPass());
+	
+	MPM.add(llvm::createLoopRotatePass());
+	MPM.add(llvm::createLICMPass());
+	MPM.add(llvm::createIndVarSimplifyPass());
+	MPM.add(llvm::createLoopVectorizePass());
+	MPM.add(llvm::createLoopUnrollPass());
+	MPM.add(llvm::createInstructionCombiningPass());
+	MPM.add(llvm::createCFGSimplificationPass());
 		
 	MPM.run(*m_llvm_module);
+	
+	if (getBuilder()->getProfile() != nullptr)
+	{
+		orderFunctions();
+	}
+	
+	checkVectorizedLoops();
 }
 
-std::string Module::compile()
+void Module::checkVectorizedLoops() const
 {
-	auto suffix = "o";
-#ifdef _WIN32
-	suffix = "obj";
-#endif
+	std::set<llvm::MDNode *> checked;
+	
+	for (auto& func : *m_llvm_module)
+	{
+		for (auto& block : func)
+		{
+			auto term = block.getTerminator();
+			if (term == nullptr)
+			{
+				continue;
+			}
+			
+			auto loop_id = term->getMetadata("llvm.loop");
+			if (loop_id == nullptr || checked.insert(loop_id).second == false)
+			{
+				continue;
+			}
+			
+			// The vectorizer sets the width of a loop it vectorized to 1.
+			std::string location = "";
+			uint64_t width = 0;
+			
+			for (unsigned int i = 1; i < loop_id->getNumOperands(); i++)
+			{
+				auto hint = llvm::dyn_cast<llvm::MDNode>(
+					loop_id->getOperand(i).get());
+				if (hint == nullptr || hint->getNumOperands() != 2)
+				{
+					continue;
+				}
+				
+				auto name = llvm::dyn_cast<llvm::MDString>(
+					hint->getOperand(0).get());
+				if (name == nullptr)
+				{
+					continue;
+				}
+				
+				if (name->getString() == LOOP_ASSERT_VECTORIZED)
+				{
+					auto loc = llvm::cast<llvm::MDString>(hint->getOperand(1).get());
+					location = loc->getString();
+				}
+				else if (name->getString() == "llvm.loop.vectorize.width")
+				{
+					width = llvm::mdconst::extract<llvm::ConstantInt>(
+						hint->getOperand(1).get())->getZExtValue();
+				}
+			}
+			
+			if (location != "" && width != 1)
+			{
+				std::cerr << location << ": warning: loop was not vectorized\n";
+			}
+		}
+	}
+}
 
-	// Get the file
+void Module::emitMachineCode(llvm::Module* module, std::string path,
+							 EmitKind kind)
+{
 	std::error_code ec;
-	auto path = getTempFile("module", suffix);
 	llvm::raw_fd_ostream raw(path, ec, llvm::sys::fs::OpenFlags::F_RW);
 
 	if (ec)
@@ -239,6 +560,10 @@ std::string Module::compile()
 	pm->add(new llvm::DataLayoutPass());
 
 	auto emission = llvm::LLVMTargetMachine::CGFT_ObjectFile;
+	if (kind == EMIT_ASM)
+	{
+		emission = llvm::LLVMTargetMachine::CGFT_AssemblyFile;
+	}
 
 	bool err = getBuilder()->getTargetMachine()->addPassesToEmitFile(*pm, strm,
 		emission, false);
@@ -247,14 +572,60 @@ std::string Module::compile()
 		throw fatal_error("could not emit file");
 	}
 
-	pm->run(*getLLVMModule());
+	pm->run(*module);
 	strm.flush();
 	raw.flush();
 	raw.close();
 
+	delete pm;
+}
+
+std::string Module::compile()
+{
+	auto suffix = "o";
+#ifdef _WIN32
+	suffix = "obj";
+#endif
+
+	// Get the file
+	auto path = getTempFile("module", suffix);
+	emitMachineCode(getLLVMModule(), path, EMIT_OBJ);
+	
 	return path;
 }
 
+void Module::emit(std::string path, EmitKind kind)
+{
+	auto module = m_unoptimized != nullptr ? m_unoptimized : m_llvm_module;
+	
+	if (kind == EMIT_OBJ || kind == EMIT_ASM)
+	{
+		emitMachineCode(module, path, kind);
+		return;
+	}
+	
+	std::error_code ec;
+	auto flags = kind == EMIT_LLVM ? llvm::sys::fs::OpenFlags::F_Text :
+		llvm::sys::fs::OpenFlags::F_None;
+	llvm::raw_fd_ostream raw(path, ec, flags);
+	
+	if (ec)
+	{
+		throw fatal_error(ec.message());
+	}
+	
+	if (kind == EMIT_LLVM)
+	{
+		module->print(raw, nullptr);
+	}
+	else
+	{
+		llvm::WriteBitcodeToFile(module, raw);
+	}
+	
+	raw.close();
+}
+
 Module::Module(Builder* builder, std::string filePath)
 {
 	if (builder == nullptr)
@@ -292,6 +663,7 @@ Module::Module(Builder* builder, std::string filePath)
 Module::~Module()
 {
 	delete m_llvm_module;
+	delete m_unoptimized;
 	delete m_ir_builder;
 	delete m_main;
 }
@@ -7,6 +7,7 @@
 */
 
 #include <grove/NegativeExpr.h>
+#include <grove/Value.h>
 
 #include <grove/types/Type.h>
 
@@ -63,6 +64,29 @@ void NegativeExpr::build()
 	setValue(val);
 }
 
+bool NegativeExpr::isPure() const
+{
+	return getExpression()->isPure();
+}
+
+Value* NegativeExpr::fold() const
+{
+	auto ty = getType();
+	if ((ty->isIntTy() && ty->isSigned()) == false &&
+		ty->isFloatingPointTy() == false)
+	{
+		return nullptr;
+	}
+	
+	auto val = getExpression()->fold();
+	if (val != nullptr)
+	{
+		val->negate();
+	}
+	
+	return val;
+}
+
 NegativeExpr::NegativeExpr(Expression* expr)
 {
 	assertExists(expr, "expr cannot be nullptr.");
@@ -0,0 +1,136 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <grove/OutlinedFunction.h>
+#include <grove/IDReference.h>
+#include <grove/Parameter.h>
+#include <grove/VarDecl.h>
+
+#include <grove/types/Type.h>
+#include <grove/types/VoidType.h>
+
+#include <grove/exceptions/code_error.h>
+
+#include <util/copy.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/IRBuilder.h>
+
+void OutlinedFunction::findCaptures()
+{
+	m_captures.clear();
+
+	for (auto ref : findChildren<IDReference *>())
+	{
+		auto node = ref->getNode();
+
+		if (node == nullptr || (node->is<VarDecl *>() == false &&
+			node->is<Parameter *>() == false))
+		{
+			continue;
+		}
+
+		// Nodes declared anywhere inside of this function aren't captured.
+		auto parent = node->as<ASTNode *>()->getParent();
+		while (parent != nullptr && parent != this)
+		{
+			parent = parent->getParent();
+		}
+
+		if (parent == this || std::find(m_captures.begin(), m_captures.end(),
+										node) != m_captures.end())
+		{
+			continue;
+		}
+
+		// The size of a variadic array only exists in the enclosing function.
+		if (node->is<VarDecl *>() &&
+			node->as<VarDecl *>()->getType()->isVariadiclySized())
+		{
+			throw code_error(ref, [ref]() -> std::string
+				{
+					std::stringstream ss;
+					ss << "variadic array " << ref->getName().str()
+					   << " cannot be used here";
+					return ss.str();
+				});
+		}
+
+		m_captures.push_back(node);
+	}
+}
+
+std::vector<Valued *> OutlinedFunction::getCaptures() const
+{
+	return m_captures;
+}
+
+bool OutlinedFunction::isFastMath() const
+{
+	return findParent<Function *>()->isFastMath();
+}
+
+void OutlinedFunction::createFunction()
+{
+	Function::createFunction();
+
+	// The runtime calls this function, so it has to use the C calling
+	// convention even though it isn't exported.
+	getLLVMFunction()->setCallingConv(llvm::CallingConv::C);
+}
+
+void OutlinedFunction::setupFunction()
+{
+	Function::setupFunction();
+
+	auto captures_ty = IRBuilder()->getInt8PtrTy()->getPointerTo();
+	auto captures = IRBuilder()->CreateBitCast(getParams().back()->getValue(),
+											   captures_ty);
+
+	m_saved_values.clear();
+
+	for (unsigned int i = 0; i < m_captures.size(); i++)
+	{
+		auto capture = m_captures[i];
+		auto outer = capture->getPointer();
+		m_saved_values.push_back(outer);
+
+		auto addr = IRBuilder()->CreateLoad(
+			IRBuilder()->CreateConstGEP1_32(captures, i));
+		capture->setValue(IRBuilder()->CreateBitCast(addr, outer->getType()));
+	}
+}
+
+ASTNode* OutlinedFunction::copy() const
+{
+	auto func = new OutlinedFunction(getName(), copyVector(getParams()));
+	func->copyStatements(this);
+	return func;
+}
+
+void OutlinedFunction::build()
+{
+	findCaptures();
+
+	Function::build();
+
+	for (unsigned int i = 0; i < m_captures.size(); i++)
+	{
+		m_captures[i]->setValue(m_saved_values[i]);
+	}
+}
+
+OutlinedFunction::OutlinedFunction(OString name,
+								   std::vector<Parameter *> params)
+: Function(name, params)
+{
+	setReturnType(VoidType::get());
+}
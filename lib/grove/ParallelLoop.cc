@@ -0,0 +1,230 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <grove/ParallelLoop.h>
+#include <grove/BinOpCompare.h>
+#include <grove/IDReference.h>
+#include <grove/IncrementExpr.h>
+#include <grove/Loop.h>
+#include <grove/LoopTerminator.h>
+#include <grove/Module.h>
+#include <grove/OutlinedFunction.h>
+#include <grove/Parameter.h>
+#include <grove/ReturnStmt.h>
+#include <grove/VarDecl.h>
+
+#include <grove/types/Type.h>
+#include <grove/types/IntType.h>
+#include <grove/types/PointerType.h>
+
+#include <grove/exceptions/code_error.h>
+#include <grove/exceptions/invalid_type_error.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include <llvm/IR/Module.h>
+#include <llvm/IR/IRBuilder.h>
+
+Loop* ParallelLoop::getBody() const
+{
+	return m_body;
+}
+
+void ParallelLoop::addHint(OString name, Value* value)
+{
+	m_body->addHint(name, value);
+}
+
+ASTNode* ParallelLoop::copy() const
+{
+	std::vector<ASTNode *> initializers;
+	initializers.push_back(m_decl->copy());
+
+	return new ParallelLoop(initializers,
+							m_condition->copy()->as<Expression *>(),
+							m_afterthought->copy()->as<Expression *>(),
+							m_body->copy()->as<Loop *>());
+}
+
+void ParallelLoop::resolve()
+{
+	auto ty = m_decl->getType();
+	if (ty->isIntTy() == false)
+	{
+		throw invalid_type_error(m_decl, "parallel for can't count with a "
+								 "variable of type", ty);
+	}
+
+	// Every chunk has to run to completion, so nothing can leave the body
+	// early.
+	for (auto ret : m_body->findChildren<ReturnStmt *>())
+	{
+		// A return in a function defined in the body only leaves that
+		// function.
+		if (ret->findParent<Function *>() != m_function)
+		{
+			continue;
+		}
+
+		throw code_error(ret, []() -> std::string
+			{
+				return "cannot return from inside a parallel for";
+			});
+	}
+
+	for (auto term : m_body->findChildren<LoopTerminator *>())
+	{
+		if (term->getTerminatorStr() == "break" &&
+			term->findParent<Loop *>() == m_body)
+		{
+			throw code_error(term, []() -> std::string
+				{
+					return "cannot break out of a parallel for";
+				});
+		}
+	}
+}
+
+void ParallelLoop::build()
+{
+	auto i64 = IntType::get(64);
+
+	m_decl->build();
+	auto begin = m_decl->getType()->cast(IRBuilder(), m_decl, i64);
+
+	auto limit = m_condition->getRHS();
+	limit->build();
+	auto end = limit->castTo(i64);
+
+	if (m_condition->getOperator() == "<=")
+	{
+		end = IRBuilder()->CreateAdd(end, IRBuilder()->getInt64(1));
+	}
+
+	m_function->build();
+
+	// Pass the addresses of the captured nodes to the outlined function.
+	auto captures = m_function->getCaptures();
+	auto i8p = IRBuilder()->getInt8PtrTy();
+
+	auto captures_ty = llvm::ArrayType::get(i8p,
+		std::max<size_t>(captures.size(), 1));
+	auto captures_slot = findParent<Function *>()->createSlot(captures_ty,
+		"parallel.ctx");
+
+	for (unsigned int i = 0; i < captures.size(); i++)
+	{
+		auto addr = IRBuilder()->CreateBitCast(captures[i]->getPointer(), i8p);
+		IRBuilder()->CreateStore(addr,
+			IRBuilder()->CreateConstGEP2_32(captures_slot, 0, i));
+	}
+
+	auto body = m_function->getLLVMFunction();
+
+	llvm::Type* params[] = { i64->getLLVMType(), i64->getLLVMType(),
+		body->getType(), i8p };
+	auto runtime_ty = llvm::FunctionType::get(IRBuilder()->getVoidTy(),
+		params, false);
+	auto runtime = getModule()->getLLVMModule()->getOrInsertFunction(
+		"orange_parallel_for", runtime_ty);
+
+	llvm::Value* args[] = { begin, end, body,
+		IRBuilder()->CreateBitCast(captures_slot, i8p) };
+	IRBuilder()->CreateCall(runtime, args);
+}
+
+ParallelLoop::ParallelLoop(std::vector<ASTNode*> initializers,
+						   Expression* condition, Expression* afterthought)
+: ParallelLoop(initializers, condition, afterthought, nullptr)
+{
+	// Do nothing.
+}
+
+ParallelLoop::ParallelLoop(std::vector<ASTNode*> initializers,
+						   Expression* condition, Expression* afterthought,
+						   Loop* body)
+: Block()
+{
+	if (initializers.size() != 1 || initializers[0]->is<VarDecl *>() == false)
+	{
+		throw code_error(initializers.back(), []() -> std::string
+			{
+				return "parallel for must declare one variable to count with";
+			});
+	}
+
+	m_decl = initializers[0]->as<VarDecl *>();
+
+	auto name = m_decl->getName();
+	auto isCounter = [name](Expression* expr) -> bool
+	{
+		return expr->ASTNode::is<IDReference *>() &&
+			expr->ASTNode::as<IDReference *>()->getName() == name;
+	};
+
+	if (condition->ASTNode::is<BinOpCompare *>() == false ||
+		(condition->ASTNode::as<BinOpCompare *>()->getOperator() != "<" &&
+		 condition->ASTNode::as<BinOpCompare *>()->getOperator() != "<=") ||
+		isCounter(condition->ASTNode::as<BinOpCompare *>()->getLHS()) == false)
+	{
+		throw code_error(condition, [name]() -> std::string
+			{
+				std::stringstream ss;
+				ss << "condition of parallel for must be " << name.str()
+				   << " < end or " << name.str() << " <= end";
+				return ss.str();
+			});
+	}
+
+	if (afterthought->ASTNode::is<IncrementExpr *>() == false ||
+		afterthought->ASTNode::as<IncrementExpr *>()->getDelta() != 1 ||
+		isCounter(afterthought->ASTNode::as<IncrementExpr *>()
+				  ->getExpression()) == false)
+	{
+		throw code_error(afterthought, [name]() -> std::string
+			{
+				std::stringstream ss;
+				ss << "parallel for must step with " << name.str() << "++";
+				return ss.str();
+			});
+	}
+
+	m_condition = condition->ASTNode::as<BinOpCompare *>();
+	m_afterthought = afterthought;
+
+	addChild(m_decl, true);
+	addChild(m_condition, true);
+	addChild(m_afterthought, true);
+
+	// Each chunk counts from lo to hi with its own copy of the variable.
+	if (body == nullptr)
+	{
+		std::vector<ASTNode *> chunk_init;
+		chunk_init.push_back(new VarDecl(m_decl->getType(), name,
+										 new IDReference("parallel.lo")));
+
+		auto chunk_cond = new BinOpCompare(new IDReference(name), "<",
+										   new IDReference("parallel.hi"));
+		auto chunk_step = new IncrementExpr(new IDReference(name), 1, false);
+
+		body = new Loop(chunk_init, chunk_cond, chunk_step, false);
+	}
+
+	std::vector<Parameter *> params;
+	params.push_back(new Parameter(IntType::get(64), "parallel.lo"));
+	params.push_back(new Parameter(IntType::get(64), "parallel.hi"));
+	params.push_back(new Parameter(PointerType::get(IntType::get(8)),
+								   "parallel.ctx"));
+
+	m_body = body;
+	m_function = new OutlinedFunction("parallel.body", params);
+	m_function->addStatement(m_body);
+
+	addChild(m_function, true);
+}
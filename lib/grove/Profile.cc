@@ -0,0 +1,94 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <grove/Profile.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/BasicBlock.h>
+
+uint64_t Profile::hash(llvm::Function* func)
+{
+	// FNV-1a over the shape of the function's control flow.
+	uint64_t h = 14695981039346656037ULL;
+	auto mix = [&h](uint64_t value)
+	{
+		h ^= value;
+		h *= 1099511628211ULL;
+	};
+	
+	for (auto& block : func->getBasicBlockList())
+	{
+		mix(block.size());
+		mix(block.getTerminator()->getNumSuccessors());
+	}
+	
+	return h;
+}
+
+const std::vector<uint64_t>* Profile::getCounters(std::string name,
+												  uint64_t hash) const
+{
+	auto it = m_records.find(name);
+	if (it == m_records.end() || it->second.hash != hash)
+	{
+		return nullptr;
+	}
+	
+	return &it->second.counters;
+}
+
+uint64_t Profile::getMaxEntryCount() const
+{
+	return m_max_entry_count;
+}
+
+Profile::Profile(std::string path)
+{
+	std::ifstream file(path);
+	if (file.is_open() == false)
+	{
+		throw std::runtime_error("error: could not open profile " + path +
+								 " for reading.");
+	}
+	
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::stringstream ss(line);
+		
+		std::string name;
+		Record rec;
+		uint64_t count = 0;
+		
+		ss >> name >> rec.hash >> count;
+		if (ss.fail() || count == 0)
+		{
+			continue;
+		}
+		
+		rec.counters.resize(count);
+		for (auto& counter : rec.counters)
+		{
+			ss >> counter;
+		}
+		
+		if (ss.fail())
+		{
+			throw std::runtime_error("error: profile " + path +
+									 " is malformed.");
+		}
+		
+		m_max_entry_count = std::max(m_max_entry_count, rec.counters[0]);
+		m_records[name] = rec;
+	}
+}
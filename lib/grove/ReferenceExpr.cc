@@ -49,6 +49,11 @@ void ReferenceExpr::build()
 	setValue(val);
 }
 
+bool ReferenceExpr::isPure() const
+{
+	return getExpression()->isPure();
+}
+
 ReferenceExpr::ReferenceExpr(Expression* expr)
 {
 	m_expression = expr;
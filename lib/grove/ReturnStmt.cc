@@ -8,8 +8,14 @@
 
 #include <grove/ReturnStmt.h>
 #include <grove/Function.h>
+#include <grove/FunctionCall.h>
 #include <grove/Expression.h>
+#include <grove/IDReference.h>
+#include <grove/ParallelLoop.h>
+#include <grove/Parameter.h>
+#include <grove/ReferenceExpr.h>
 
+#include <grove/types/Type.h>
 #include <grove/types/VoidType.h>
 
 #include <grove/exceptions/code_error.h>
@@ -18,6 +24,7 @@
 #include <util/llvmassertions.h>
 
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Instructions.h>
 
 Expression* ReturnStmt::getExpression()
 {
@@ -29,6 +36,85 @@ bool ReturnStmt::hasExpression()
 	return m_expr != nullptr;
 }
 
+bool ReturnStmt::isTailCall() const
+{
+	return m_tail_call;
+}
+
+void ReturnStmt::checkTailCall(Function* func, llvm::CallInst* call)
+{
+	// The callee reuses the stack frame of the caller, so its prototype has
+	// to match.
+	auto callee = call->getCalledFunction();
+	
+	if (callee == nullptr || callee->getFunctionType() !=
+		func->getLLVMFunction()->getFunctionType())
+	{
+		throw code_error(this, func, []() -> std::string
+			{
+				return "tail call must be to a function with the same "
+					"parameter and return types";
+			});
+	}
+	
+	// main and exported functions use the C calling convention and
+	// everything else uses fastcc, and a musttail call can't switch between
+	// them.
+	if (callee->getCallingConv() != func->getLLVMFunction()->getCallingConv())
+	{
+		throw code_error(this, func, []() -> std::string
+			{
+				return "tail call must be to a function with the same "
+					"calling convention";
+			});
+	}
+	
+	// Nothing on the stack of the caller can be used once it's been
+	// replaced by the callee, so its address can't have been handed out.
+	bool escapes = func->findChildren<ReferenceExpr *>().size() > 0 ||
+		func->findChildren<ParallelLoop *>().size() > 0;
+	
+	for (auto other : func->findChildren<FunctionCall *>())
+	{
+		for (auto arg : other->getArgs())
+		{
+			// Arrays are passed by their address.
+			escapes = escapes || arg->getType()->isArrayTy();
+		}
+	}
+	
+	if (escapes)
+	{
+		throw code_error(this, func, []() -> std::string
+			{
+				return "cannot make a tail call from a function that passes "
+					"the address of a local variable";
+			});
+	}
+	
+	auto args = getExpression()->ASTNode::as<FunctionCall *>()->getArgs();
+	
+	for (auto arg : args)
+	{
+		auto ty = arg->getType();
+		
+		// Pointers passed into the caller don't point to its stack.
+		bool is_param = arg->ASTNode::is<IDReference *>() &&
+			arg->ASTNode::as<IDReference *>()->getNode()->is<Parameter *>();
+		
+		if (ty->isArrayTy() || (ty->isPointerTy() && is_param == false))
+		{
+			throw code_error(arg, []() -> std::string
+				{
+					return "cannot pass a pointer to a local variable in a "
+						"tail call";
+				});
+		}
+	}
+	
+	call->setTailCallKind(llvm::CallInst::TCK_MustTail);
+}
+
 bool ReturnStmt::isTerminator() const
 {
 	return true;
@@ -38,7 +124,7 @@ ASTNode* ReturnStmt::copy() const
 {
 	if (m_expr)
 	{
-		return new ReturnStmt(m_expr->copy()->as<Expression *>());
+		return new ReturnStmt(m_expr->copy()->as<Expression *>(), m_tail_call);
 	}
 	else
 	{
@@ -58,6 +144,14 @@ void ReturnStmt::resolve()
 	{
 		setType(VoidType::get());
 	}
+	
+	if (isTailCall() && getExpression()->ASTNode::is<FunctionCall *>() == false)
+	{
+		throw code_error(getExpression(), []() -> std::string
+			{
+				return "expected a function call after tailcall";
+			});
+	}
 }
 
 void ReturnStmt::build()
@@ -97,6 +191,29 @@ void ReturnStmt::build()
     		}
     	}
 		
+		// Returning the result of a call directly keeps the call in tail
+		// position.
+		if (llvm::isa<llvm::CallInst>(value) &&
+			value->getType() == func->getLLVMFunction()->getReturnType())
+		{
+			if (isTailCall())
+			{
+				checkTailCall(func, llvm::cast<llvm::CallInst>(value));
+			}
+			
+			IRBuilder()->CreateRet(value);
+			return;
+		}
+		
+		if (isTailCall())
+		{
+			throw code_error(this, func, []() -> std::string
+				{
+					return "tail call must return the same type as the "
+						"function it's in";
+				});
+		}
+		
 		auto ptr = func->getRetValue();
 		
     	assertEqual<VAL,PTR>(value, ptr, "Can't store incompatible type.");
@@ -108,8 +225,15 @@ void ReturnStmt::build()
 }
 
 ReturnStmt::ReturnStmt(Expression* expression)
+: ReturnStmt(expression, false)
+{
+	// Do nothing.
+}
+
+ReturnStmt::ReturnStmt(Expression* expression, bool tailCall)
 {
 	addChild(expression);
 	
 	m_expr = expression;
+	m_tail_call = tailCall;
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 
 #include <grove/SizeofExpr.h>
 #include <grove/Module.h>
+#include <grove/Value.h>
 #include <grove/Valued.h>
 
 #include <grove/types/Type.h>
@@ -57,6 +58,8 @@ void SizeofExpr::resolve()
 										 "with size of type", size->getType());
 			}
 		}
+		
+		m_type_arg = getTypeArg()->getFoldedTy();
 	}
 }
 
@@ -103,6 +106,31 @@ void SizeofExpr::build()
 	setValue(val);
 }
 
+bool SizeofExpr::isPure() const
+{
+	return getExpressionArg() == nullptr || getExpressionArg()->isPure();
+}
+
+Value* SizeofExpr::fold() const
+{
+	auto ty = getTypeArg();
+	if (ty == nullptr)
+	{
+		ty = getExpressionArg()->getType();
+	}
+	
+	// The size of a variadic array isn't known until run time.
+	if (ty->isVariadiclySized() || ty->isVarTy() || ty->isVoidTy())
+	{
+		return nullptr;
+	}
+	
+	auto target = getModule()->getLLVMModule()->getDataLayout();
+	auto sz = target->getTypeAllocSize(ty->getLLVMType());
+	
+	return Value::fromUInt(sz, getType());
+}
+
 SizeofExpr::SizeofExpr(Type* typeArg)
 {
 	assertExists(typeArg, "typeArg cannot be null");
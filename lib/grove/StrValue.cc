@@ -7,11 +7,13 @@
 */
 
 #include <grove/StrValue.h>
+#include <grove/Module.h>
 
 #include <grove/types/PointerType.h>
 #include <grove/types/IntType.h>
 
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/GlobalVariable.h>
 
 const void replaceAll(std::string& str, const std::string& from,
 					  const std::string& to)
@@ -49,8 +51,12 @@ ASTNode* StrValue::copy() const
 
 void StrValue::build()
 {
-	auto val = IRBuilder()->CreateGlobalString(m_str);
-	setValue(val);
+	setValue(getModule()->getStringConstant(m_str));
+}
+
+bool StrValue::isPure() const
+{
+	return true;
 }
 
 StrValue::StrValue(std::string value)
@@ -0,0 +1,289 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <grove/SwitchStmt.h>
+#include <grove/CaseBlock.h>
+#include <grove/Function.h>
+#include <grove/Expression.h>
+#include <grove/Value.h>
+#include <grove/Module.h>
+
+#include <grove/types/Type.h>
+#include <grove/types/EnumType.h>
+
+#include <grove/exceptions/invalid_type_error.h>
+#include <grove/exceptions/code_error.h>
+#include <grove/exceptions/fatal_error.h>
+
+#include <util/assertions.h>
+#include <util/copy.h>
+
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Constants.h>
+
+#include <set>
+#include <sstream>
+
+Expression* SwitchStmt::getCondition() const
+{
+	return m_condition;
+}
+
+std::vector<Block *> SwitchStmt::getBlocks() const
+{
+	return m_switch_blocks;
+}
+
+llvm::BasicBlock* SwitchStmt::continueBlock() const
+{
+	return m_continue_block;
+}
+
+void SwitchStmt::addBlock(Block *block)
+{
+	assertExists(block, "Block must exist!");
+	
+	if (hasElse())
+	{
+		throw fatal_error("trying to add a block after an else block");
+	}
+	
+	m_switch_blocks.push_back(block);
+	addChild(block);
+}
+
+bool SwitchStmt::isElse(Block *block) const
+{
+	return block->is<CaseBlock *>() == false;
+}
+
+bool SwitchStmt::hasElse() const
+{
+	for (auto block : m_switch_blocks)
+	{
+		if (isElse(block))
+		{
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+bool SwitchStmt::isTerminator() const
+{
+	if (hasElse() == false)
+	{
+		return false;
+	}
+	
+	for (auto block : m_switch_blocks)
+	{
+		if (block->isTerminator() == false)
+		{
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+ASTNode* SwitchStmt::copy() const
+{
+	auto ret = new SwitchStmt(getCondition()->copy()->as<Expression *>());
+	
+	for (auto block : copyVector(m_switch_blocks))
+	{
+		ret->addBlock(block);
+	}
+	
+	return ret;
+}
+
+void SwitchStmt::resolve()
+{
+	auto ty = getCondition()->getType();
+	assertExists(ty, "Condition has no type!");
+	
+	if (ty->isIntTy() == false && ty->is<EnumType *>() == false)
+	{
+		throw invalid_type_error(getCondition(), "cannot switch on value of "
+								 "type", ty);
+	}
+	
+	auto width = ty->getLLVMType()->getIntegerBitWidth();
+	
+	// Every value must fit in the condition, and each value may only appear
+	// once in the whole statement. CaseBlock has already checked that the
+	// values are constants.
+	std::set<uint64_t> seen;
+	
+	for (auto block : getBlocks())
+	{
+		if (isElse(block))
+		{
+			continue;
+		}
+		
+		for (auto value : block->as<CaseBlock *>()->getValues())
+		{
+			auto folded = value->fold();
+			assertExists(folded, "Case value isn't constant!");
+			
+			auto is_signed = folded->getType()->isSigned();
+			auto int_val = llvm::APInt(64, folded->getUInt());
+			
+			std::stringstream str;
+			if (is_signed)
+			{
+				str << folded->getInt();
+			}
+			else
+			{
+				str << folded->getUInt();
+			}
+			
+			delete folded;
+			
+			bool fits = false;
+			
+			if (ty->isSigned())
+			{
+				fits = (is_signed || int_val.isNonNegative()) &&
+					int_val.isSignedIntN(width);
+			}
+			else
+			{
+				fits = (is_signed == false || int_val.isNonNegative()) &&
+					int_val.isIntN(width);
+			}
+			
+			auto val_str = str.str();
+			
+			if (fits == false)
+			{
+				throw code_error(value, [val_str, ty]() -> std::string
+					{
+						std::stringstream ss;
+						ss << "case value " << val_str << " doesn't fit in "
+						   << ty->getString();
+						
+						return ss.str();
+					});
+			}
+			
+			auto key = int_val.zextOrTrunc(width).getZExtValue();
+			
+			if (seen.insert(key).second == false)
+			{
+				throw code_error(value, [val_str]() -> std::string
+					{
+						return "duplicate case value " + val_str;
+					});
+			}
+		}
+	}
+}
+
+void SwitchStmt::build()
+{
+	auto parent_func = findParent<Function *>();
+	auto llvm_func = parent_func->getLLVMFunction();
+	auto& ctx = getModule()->getLLVMContext();
+	
+	getCondition()->build();
+	
+	auto cond = getCondition()->getValue();
+	assertExists(cond, "Condition generated no value!");
+	
+	auto cond_width = cond->getType()->getIntegerBitWidth();
+	
+	// Generate all the bodies.
+	std::vector<llvm::BasicBlock *> bodies;
+	for (unsigned int i = 0; i < getBlocks().size(); i++)
+	{
+		auto bb = llvm::BasicBlock::Create(ctx, "switch_body", llvm_func,
+										   parent_func->getExit());
+		bodies.push_back(bb);
+	}
+	
+	if (isTerminator() == false)
+	{
+		m_continue_block = llvm::BasicBlock::Create(ctx, "switch_continue",
+													llvm_func,
+													parent_func->getExit());
+	}
+	
+	// The else block is always last.
+	auto default_block = hasElse() ? bodies.back() : m_continue_block;
+	
+	unsigned int num_cases = 0;
+	for (auto block : getBlocks())
+	{
+		if (isElse(block) == false)
+		{
+			num_cases += block->as<CaseBlock *>()->getValues().size();
+		}
+	}
+	
+	auto inst = IRBuilder()->CreateSwitch(cond, default_block, num_cases);
+	
+	// Add every value as a case. resolve has checked that each is a
+	// constant that fits in the condition.
+	for (unsigned int i = 0; i < getBlocks().size(); i++)
+	{
+		auto block = getBlocks().at(i);
+		
+		if (isElse(block))
+		{
+			continue;
+		}
+		
+		for (auto value : block->as<CaseBlock *>()->getValues())
+		{
+			auto folded = value->fold();
+			assertExists(folded, "Case value isn't constant!");
+			
+			auto int_val = llvm::APInt(64, folded->getUInt());
+			delete folded;
+			
+			int_val = int_val.zextOrTrunc(cond_width);
+			
+			auto case_val = llvm::ConstantInt::get(ctx, int_val);
+			inst->addCase(case_val, bodies.at(i));
+		}
+	}
+	
+	// Generate all the blocks.
+	for (unsigned int i = 0; i < getBlocks().size(); i++)
+	{
+		auto block = getBlocks().at(i);
+		
+		IRBuilder()->SetInsertPoint(bodies.at(i));
+		block->build();
+		
+		// If the block isn't a terminator, go to continue.
+		if (block->isTerminator() == false)
+		{
+			IRBuilder()->CreateBr(m_continue_block);
+		}
+	}
+	
+	if (m_continue_block != nullptr)
+	{
+		IRBuilder()->SetInsertPoint(m_continue_block);
+	}
+}
+
+SwitchStmt::SwitchStmt(Expression* condition)
+{
+	assertExists(condition, "Condition can not be null!");
+	
+	m_condition = condition;
+	addChild(m_condition);
+}
@@ -9,6 +9,7 @@
 #include <grove/TernaryExpr.h>
 #include <grove/Function.h>
 #include <grove/Module.h>
+#include <grove/Value.h>
 
 #include <grove/types/Type.h>
 
@@ -82,6 +83,40 @@ void TernaryExpr::resolve()
 
 void TernaryExpr::build()
 {
+	// Only the side that's taken needs to be built when the condition is
+	// known at compile time.
+	auto cond = getCondition()->fold();
+	if (cond != nullptr)
+	{
+		auto taken = cond->getUInt() != 0 ? getTrueVal() : getFalseVal();
+		delete cond;
+		
+		taken->build();
+		setValue(taken->getValue());
+		return;
+	}
+	
+	getCondition()->build();
+	
+	auto vCondition = getCondition()->getValue();
+	assertExists(vCondition, "condition generated no value");
+	
+	// If both values are cheap to compute and have no side effects,
+	// compute both of them and select between them without branching.
+	if (getTrueVal()->isCheap() && getFalseVal()->isCheap())
+	{
+		getTrueVal()->build();
+		auto vTrue = getTrueVal()->getValue();
+		assertExists(vTrue, "true expr generated no value");
+		
+		getFalseVal()->build();
+		auto vFalse = getFalseVal()->getValue();
+		assertExists(vFalse, "false expr generated no value");
+		
+		setValue(IRBuilder()->CreateSelect(vCondition, vTrue, vFalse));
+		return;
+	}
+	
 	// Setup blocks
 	auto parent_func = findParent<Function *>();
 	auto llvm_func = parent_func->getLLVMFunction();
@@ -93,30 +128,51 @@ void TernaryExpr::build()
 												parent_func->getExit());
 	auto continue_block = llvm::BasicBlock::Create(ctx, "continue", llvm_func,
 												   parent_func->getExit());
-
-	getCondition()->build();
 	
-	auto vCondition = getCondition()->getValue();
-	assertExists(vCondition, "condition generated no value");
-	
-	auto val = IRBuilder()->CreateAlloca(getType()->getLLVMType());
 	IRBuilder()->CreateCondBr(vCondition, true_block, false_block);
 	
+	// Building a value may create new blocks, so the incoming block for each
+	// value is wherever its code ended.
 	IRBuilder()->SetInsertPoint(true_block);
 	getTrueVal()->build();
-	assertExists(getTrueVal()->getValue(), "true expr generated no value");
-	IRBuilder()->CreateStore(getTrueVal()->getValue(), val);
+	auto vTrue = getTrueVal()->getValue();
+	assertExists(vTrue, "true expr generated no value");
+	auto true_end = IRBuilder()->GetInsertBlock();
 	IRBuilder()->CreateBr(continue_block);
 	
 	IRBuilder()->SetInsertPoint(false_block);
 	getFalseVal()->build();
-	assertExists(getFalseVal()->getValue(), "false expr generated no value");
-	IRBuilder()->CreateStore(getFalseVal()->getValue(), val);
+	auto vFalse = getFalseVal()->getValue();
+	assertExists(vFalse, "false expr generated no value");
+	auto false_end = IRBuilder()->GetInsertBlock();
 	IRBuilder()->CreateBr(continue_block);
 	
 	IRBuilder()->SetInsertPoint(continue_block);
 	
-	setValue(IRBuilder()->CreateLoad(val));
+	auto phi = IRBuilder()->CreatePHI(vTrue->getType(), 2);
+	phi->addIncoming(vTrue, true_end);
+	phi->addIncoming(vFalse, false_end);
+	setValue(phi);
+}
+
+bool TernaryExpr::isPure() const
+{
+	return getCondition()->isPure() && getTrueVal()->isPure() &&
+		getFalseVal()->isPure();
+}
+
+Value* TernaryExpr::fold() const
+{
+	auto cond = getCondition()->fold();
+	if (cond == nullptr)
+	{
+		return nullptr;
+	}
+	
+	bool taken = cond->getUInt() != 0;
+	delete cond;
+	
+	return taken ? getTrueVal()->fold() : getFalseVal()->fold();
 }
 
 TernaryExpr::TernaryExpr(Expression* condition, Expression* trueval,
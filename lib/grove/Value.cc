@@ -10,6 +10,8 @@
 
 #include <grove/types/Type.h>
 #include <grove/types/IntType.h>
+#include <grove/types/UIntType.h>
+#include <grove/types/DoubleType.h>
 
 #include <grove/exceptions/invalid_type_error.h>
 #include <grove/exceptions/fatal_error.h>
@@ -37,6 +39,16 @@ bool Value::isConstant() const
 	return true;
 }
 
+bool Value::isPure() const
+{
+	return true;
+}
+
+Value* Value::fold() const
+{
+	return copy()->as<Value *>();
+}
+
 int64_t Value::getInt() const
 {
 	return m_values.i;
@@ -81,9 +93,29 @@ void Value::build()
 	}
 }
 
+void Value::fitToType()
+{
+	if (getType()->isIntTy() == false || getType()->getIntegerBitWidth() >= 64)
+	{
+		return;
+	}
+	
+	auto width = getType()->getIntegerBitWidth();
+	auto mask = (UINT64_C(1) << width) - 1;
+	
+	m_values.u &= mask;
+	
+	if (getType()->isSigned())
+	{
+		auto sign = UINT64_C(1) << (width - 1);
+		m_values.i = (int64_t)((m_values.u ^ sign) - sign);
+	}
+}
+
 void Value::convert(Type *new_ty)
 {
-	if (new_ty->isIntTy() == false && new_ty->isFloatingPointTy())
+	if (new_ty->isIntTy() == false && new_ty->isFloatingPointTy() == false &&
+		new_ty->isBoolTy() == false)
 	{
 		throw fatal_error("invalid type for Value conversion");
 	}
@@ -95,41 +127,42 @@ void Value::convert(Type *new_ty)
 		return;
 	}
 	
-	if (old_ty->isIntTy() && old_ty->isSigned())
+	bool from_fp = old_ty->isFloatingPointTy();
+	bool from_signed = old_ty->isIntTy() && old_ty->isSigned();
+	
+	if (new_ty->isBoolTy())
 	{
-		if (new_ty->isIntTy() && new_ty->isSigned() == false)
-		{
-			m_values.u = (uint64_t)m_values.i;
-		}
-		else if (new_ty->isFloatingPointTy())
-		{
-			m_values.d = (double)m_values.i;
-		}
+		m_values.u = from_fp ? (m_values.d != 0) : (m_values.u != 0);
 	}
-	else if (old_ty->isIntTy() && old_ty->isSigned() == false)
+	else if (new_ty->isFloatingPointTy())
 	{
-		if (new_ty->isIntTy() && new_ty->isSigned())
+		if (from_signed)
 		{
-			m_values.i = (uint64_t)m_values.u;
+			m_values.d = (double)m_values.i;
 		}
-		else if (new_ty->isFloatingPointTy())
+		else if (from_fp == false)
 		{
 			m_values.d = (double)m_values.u;
 		}
-	}
-	else if (old_ty->isFloatingPointTy())
-	{
-		if (new_ty->isIntTy() && new_ty->isSigned())
-		{
-			m_values.i = (uint64_t)m_values.d;
-		}
-		else if (new_ty->isIntTy() && new_ty->isSigned() == false)
+		
+		if (new_ty->isFloatTy())
 		{
-			m_values.u = (double)m_values.d;
+			m_values.d = (float)m_values.d;
 		}
 	}
+	else if (from_fp && new_ty->isSigned())
+	{
+		m_values.i = (int64_t)m_values.d;
+	}
+	else if (from_fp)
+	{
+		m_values.u = (uint64_t)m_values.d;
+	}
 	
+	// Integers keep their bits and are truncated or extended to the new
+	// width.
 	setType(new_ty);
+	fitToType();
 }
 
 Value* Value::addDelta(int64_t d) const
@@ -167,6 +200,7 @@ void Value::negate()
 	if (getType()->isIntTy())
 	{
 		m_values.i = -m_values.i;
+		fitToType();
 	}
 	else if (getType()->isFloatingPointTy())
 	{
@@ -174,6 +208,33 @@ void Value::negate()
 	}
 }
 
+Value* Value::fromInt(int64_t i, Type* t)
+{
+	auto v = new Value();
+	v->m_type = IntType::get(64);
+	v->m_values.i = i;
+	v->convert(t);
+	return v;
+}
+
+Value* Value::fromUInt(uint64_t u, Type* t)
+{
+	auto v = new Value();
+	v->m_type = UIntType::get(64);
+	v->m_values.u = u;
+	v->convert(t);
+	return v;
+}
+
+Value* Value::fromDouble(double d, Type* t)
+{
+	auto v = new Value();
+	v->m_type = DoubleType::get();
+	v->m_values.d = d;
+	v->convert(t);
+	return v;
+}
+
 Value::Value(char c)
 {
 	m_values.i = (int)c;
@@ -19,6 +19,11 @@ bool Valued::hasPointer() const
 	return false;
 }
 
+unsigned int Valued::getAlignment() const
+{
+	return 0;
+}
+
 llvm::Value* Valued::getSize() const
 {
 	return m_size;
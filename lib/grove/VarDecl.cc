@@ -8,11 +8,16 @@
 
 #include <grove/VarDecl.h>
 #include <grove/Expression.h>
+#include <grove/Function.h>
+#include <grove/Module.h>
+#include <grove/ArrayValue.h>
+#include <grove/Value.h>
 
 #include <grove/types/Type.h>
 #include <grove/types/UIntType.h>
 
 #include <grove/exceptions/already_defined_error.h>
+#include <grove/exceptions/code_error.h>
 #include <grove/exceptions/invalid_type_error.h>
 #include <grove/exceptions/fatal_error.h>
 
@@ -20,6 +25,7 @@
 #include <util/llvmassertions.h>
 
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/GlobalVariable.h>
 
 llvm::Value* VarDecl::getValue() const
 {
@@ -37,6 +43,29 @@ bool VarDecl::hasPointer() const
 	return true;
 }
 
+unsigned int VarDecl::getAlignment() const
+{
+	return m_alignment;
+}
+
+void VarDecl::setAlignment(Value* value)
+{
+	// LLVM can't align anything to more than 2^29 bytes.
+	const int64_t max_alignment = 1 << 29;
+	
+	if (value->getType()->isIntTy() == false || value->getInt() <= 0 ||
+		value->getInt() > max_alignment ||
+		(value->getInt() & (value->getInt() - 1)) != 0)
+	{
+		throw code_error(value, []() -> std::string
+			{
+				return "alignment must be a power of two";
+			});
+	}
+	
+	m_alignment = (unsigned int)value->getInt();
+}
+
 Expression* VarDecl::getExpression() const
 {
 	return m_expr;
@@ -44,14 +73,19 @@ Expression* VarDecl::getExpression() const
 
 ASTNode* VarDecl::copy() const
 {
+	VarDecl* decl = nullptr;
+	
 	if (m_expr)
 	{
-		return new VarDecl(m_type, m_name, m_expr->copy()->as<Expression *>());
+		decl = new VarDecl(m_type, m_name, m_expr->copy()->as<Expression *>());
 	}
 	else
 	{
-		return new VarDecl(m_type, m_name, nullptr);
+		decl = new VarDecl(m_type, m_name, nullptr);
 	}
+	
+	decl->m_alignment = m_alignment;
+	return decl;
 }
 
 void VarDecl::resolve()
@@ -100,11 +134,45 @@ void VarDecl::resolve()
 										 "with size of type", size->getType());
 			}
 		}
+		
+		// Sizes known at compile time make a fixed-size array, which
+		// doesn't have to be allocated at run time.
+		setType(getType()->getFoldedTy());
 	}
 }
 
+bool VarDecl::isWritten() const
+{
+	return findParent<Function *>()->isWritten(this);
+}
+
 void VarDecl::build()
 {
+	// A constant array initializer lives in a read-only global. If this
+	// variable is never written to, it can use the global directly.
+	ArrayValue* const_array = nullptr;
+	
+	if (getExpression() && getExpression()->ASTNode::is<ArrayValue *>() &&
+		getExpression()->isConstant() && getExpression()->getType()
+		->getLLVMType() == getType()->getLLVMType())
+	{
+		const_array = getExpression()->ASTNode::as<ArrayValue *>();
+	}
+	
+	if (const_array != nullptr && isWritten() == false)
+	{
+		const_array->build();
+		
+		auto global = const_array->getGlobal();
+		if (m_alignment > global->getAlignment())
+		{
+			global->setAlignment(m_alignment);
+		}
+		
+		setValue(global);
+		return;
+	}
+	
 	if (getType()->isVariadiclySized())
 	{
 		for (auto s : getType()->getVariadicSizes())
@@ -123,10 +191,37 @@ void VarDecl::build()
 		}
 	}
 	
-	setValue(IRBuilder()->CreateAlloca(getType()->getLLVMType(), m_size,
-									   getName().str()));
+	llvm::AllocaInst* slot = nullptr;
+	
+	if (m_size != nullptr)
+	{
+		// Variadic arrays have to be allocated where their size is known.
+		// Loops containing them restore the stack after each iteration.
+		slot = IRBuilder()->CreateAlloca(getType()->getLLVMType(), m_size,
+										 getName().str());
+	}
+	else
+	{
+		auto func = findParent<Function *>();
+		slot = func->createSlot(getType()->getLLVMType(), getName().str());
+	}
+	
+	if (m_alignment != 0)
+	{
+		slot->setAlignment(m_alignment);
+	}
+	
+	setValue(slot);
 
-	if (getExpression())
+	if (const_array != nullptr)
+	{
+		const_array->build();
+		
+		auto size = llvm::ConstantExpr::getSizeOf(getType()->getLLVMType());
+		IRBuilder()->CreateMemCpy(getPointer(), const_array->getGlobal(), size,
+								  0);
+	}
+	else if (getExpression())
 	{
 		getExpression()->build();
 		auto val = getExpression()->getValue();
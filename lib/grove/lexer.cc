@@ -377,8 +377,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 108
-#define YY_END_OF_BUFFER 109
+#define YY_NUM_RULES 142
+#define YY_END_OF_BUFFER 143
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -386,35 +386,50 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[242] =
+static yyconst flex_int16_t yy_accept[390] =
     {   0,
-        0,    0,    0,    0,  109,  107,    1,   90,  107,  107,
-        2,  100,   77,  107,   62,   63,   98,   96,   91,   97,
-       88,   99,   20,   20,   20,  102,   89,   94,   80,   95,
-      101,  106,   66,   67,   79,  106,  106,  106,  106,  106,
-      106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
-      106,  106,   64,   78,   65,    6,  108,    5,   71,    0,
-      105,    0,    2,   85,   73,    0,   83,   69,   81,   70,
-       82,   86,    0,   84,    0,   20,   20,    3,   19,   18,
-        4,    0,   87,   92,   72,   93,  106,  106,  106,  106,
-      106,  106,  106,   35,  106,  106,  106,  106,  106,  106,
-
-       29,  106,  106,  106,   76,  106,  106,  106,  106,  106,
-      106,  106,  106,  106,  106,  106,  106,   74,    5,   21,
-       68,    9,    0,    0,    0,   11,    0,    0,    0,   10,
-       75,  106,  106,  106,  106,   24,  106,  106,  106,   28,
-      106,  106,  106,  106,   30,   49,  106,  103,  106,  106,
-      106,  106,  106,  106,  106,  106,  106,   47,  106,  106,
-      106,    8,    7,   13,   15,   17,   12,   14,   16,  106,
-       48,  106,  106,  106,  106,   26,   27,   46,  106,  106,
-      106,  106,  106,  106,  106,   53,   32,  106,  106,  106,
-      106,  106,   23,   50,  106,  106,   61,   37,  106,   34,
-
-       39,   45,  106,  106,  106,   22,   51,  106,   55,   57,
-       59,  106,  106,  106,  106,  106,  106,  106,  106,   54,
-      106,   40,   36,  106,   52,   44,  106,  106,   41,   25,
-       43,  104,   56,   58,   60,   38,  106,   31,   42,   33,
-        0
+        0,    0,    0,    0,  143,  141,    1,   95,  141,  141,
+        2,  105,   82,  141,   67,   68,  103,  101,   96,  102,
+       93,  104,   20,   20,   20,  107,   94,   99,   85,  100,
+      106,  140,   71,   72,   84,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,   69,   83,   70,    6,  142,    5,   76,    0,
+      139,    0,    2,   90,   78,    0,   88,   74,   86,   75,
+       87,   91,    0,   89,    0,   20,   20,    3,   19,   18,
+        4,    0,   92,   97,   77,   98,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,   36,  140,
+
+      140,  140,  140,  140,  140,   30,  140,  140,  140,  140,
+       81,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+       79,    5,   21,   73,    9,    0,    0,    0,   11,    0,
+        0,    0,   10,  140,   80,  140,  140,  140,  140,  140,
+      140,  111,  140,  112,   24,  140,  140,  140,   29,  140,
+      140,  140,  140,   31,   53,  140,  140,  108,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,   51,  140,
+      140,  140,    8,    7,   13,   15,   17,   12,   14,   16,
+
+      140,  140,  140,  140,  140,   52,  140,  140,  140,  140,
+       27,   28,   50,  140,  140,  140,  140,  140,  140,  140,
+       57,  140,  140,   33,  140,  140,  140,  140,  140,  140,
+      140,  114,  115,  140,  140,  140,  140,  140,  140,  140,
+       23,   54,  140,  140,  140,  140,   65,   38,  140,   49,
+      140,  140,   35,  113,   42,   48,  140,  140,  140,   22,
+       55,  140,   59,   61,   63,   66,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  130,  140,
+      140,  140,  140,  140,   58,  140,  140,  140,   43,   37,
+      117,  140,  140,   56,   47,  140,  140,  140,   66,  119,
+
+      140,  140,  140,  140,   44,  140,   25,  132,   46,  140,
+      109,   39,  140,   60,   62,   64,   41,  140,  140,  140,
+      140,  140,   32,  140,  140,  140,   45,  140,  131,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,   34,
+       40,  110,  116,  140,  140,  140,   26,  120,  140,  140,
+      140,  140,  140,  140,  128,  140,  140,  140,  140,  140,
+      140,  140,  140,  138,  140,  125,  127,  124,  140,  140,
+      140,  126,  129,  133,  137,  136,  135,  134,  140,  140,
+      121,  140,  118,  140,  122,  140,  140,  123,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -432,7 +447,7 @@ static yyconst flex_int32_t yy_ec[256] =
 
        44,   45,   46,   47,   48,   34,   49,   50,   51,   52,
        53,   54,   34,   55,   56,   57,   58,   59,   60,   61,
-       34,   62,   63,   64,   65,    1,    1,   34,   34,   34,
+       62,   63,   64,   65,   66,    1,    1,   34,   34,   34,
        34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
        34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
        34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
@@ -449,7 +464,7 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[66] =
+static yyconst flex_int32_t yy_meta[67] =
     {   0,
         1,    1,    2,    3,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    4,    4,
@@ -457,72 +472,106 @@ static yyconst flex_int32_t yy_meta[66] =
         1,    1,    5,    6,    1,    1,    1,    1,    6,    5,
         5,    5,    4,    5,    4,    6,    6,    6,    6,    6,
         6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
-        6,    6,    1,    1,    1
+        6,    6,    6,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[249] =
+static yyconst flex_int16_t yy_base[397] =
     {   0,
-        0,    0,   63,  106,  336,  337,  337,  337,  305,   61,
-        0,  304,  324,    0,  337,  337,  302,   60,  337,   61,
-      314,  300,  135,  268,   52,  337,  337,   64,  298,  297,
-      337,    0,  337,  337,  337,  274,  270,   23,   25,   49,
-       62,   23,  271,  270,  267,   40,  277,   70,  265,   85,
-       71,  272,  337,  101,  337,  337,  337,    0,  337,  108,
-      337,  315,    0,  337,  337,  307,  337,  337,  337,  337,
-      337,  337,  299,  337,  147,  254,    0,  337,  155,  162,
-      337,  144,  337,  337,  337,  337,    0,  271,  269,  272,
-      271,  258,  264,  250,   87,   76,  250,  256,  252,  249,
-
-        0,  246,  249,  258,    0,  252,  258,  241,  257,  234,
-      237,  242,  243,  244,  236,  242,   92,  159,    0,  337,
-      337,   36,  264,  267,  264,  337,  261,  264,  261,  337,
-        0,  243,  227,  225,   66,    0,  239,  234,  234,    0,
-      226,  232,  219,  234,  229,  169,  218,    0,  212,  220,
-      211,  213,  223,  222,  208,  220,  211,    0,  219,  209,
-      210,  337,  337,  337,  337,  337,  337,  337,  337,  210,
-        0,  202,  200,  208,  205,    0,    0,    0,  199,  209,
-      186,  179,  212,  201,  198,    0,    0,  180,  171,  163,
-      173,  163,    0,  181,  159,  168,    0,    0,  169,    0,
-
-        0,    0,  160,  167,  158,    0,    0,  165,    0,    0,
-        0,  148,  162,  150,  155,  152,  167,  169,  163,    0,
-      118,    0,    0,  104,    0,    0,   98,  101,    0,    0,
-        0,    0,    0,    0,    0,    0,   94,    0,    0,    0,
-      337,  223,  229,  235,  241,  244,  247,   96
+        0,    0,   64,  107,  511,  512,  512,  512,  480,   62,
+        0,  479,  499,    0,  512,  512,  477,   61,  512,   62,
+      489,  475,  136,  443,   53,  512,  512,   65,  473,  472,
+      512,    0,  512,  512,  512,   63,   14,   88,   27,   50,
+       72,   51,   26,  448,  445,   81,   93,  119,   61,  116,
+      125,  452,  512,  150,  512,  512,  512,    0,  512,  118,
+      512,  495,    0,  512,  512,  487,  512,  512,  512,  512,
+      512,  512,  479,  512,  183,  434,    0,  512,  160,  167,
+      512,  155,  512,  512,  512,  512,    0,  446,  450,  436,
+      438,  446,  429,  448,   36,  435,  423,  440,  426,  142,
+
+      152,  426,  432,  428,  425,    0,  422,  429,  424,  433,
+        0,  420,  420,  168,  432,  156,  415,  421,  160,  407,
+      419,  420,  419,  408,  413,   27,  416,  408,  414,  173,
+      203,    0,  512,  512,   99,  436,  439,  436,  512,  433,
+      436,  433,  512,  409,    0,  396,  402,  412,  411,  395,
+      393,    0,  168,    0,    0,  407,  402,  402,    0,  394,
+      400,  387,  402,  397,  206,  396,  385,    0,  398,  395,
+      391,  376,  384,  375,  374,  121,  387,  375,  384,  384,
+      387,  369,  375,  380,  366,  185,  378,  369,    0,  377,
+      367,  368,  512,  512,  512,  512,  512,  512,  512,  512,
+
+      365,  365,  367,  365,  359,    0,  356,  354,  362,  359,
+        0,    0,    0,  353,  363,  349,  346,  379,  382,  379,
+      340,  214,  350,    0,  349,  345,  353,  356,  347,  352,
+      338,    0,    0,  350,  347,  345,  336,  331,  345,  344,
+        0,  221,  329,  335,  343,  336,    0,    0,  337,    0,
+      336,  337,    0,    0,    0,    0,  326,  333,  324,    0,
+      189,  331,  313,  312,  311,  232,  309,  320,  311,  311,
+      310,  324,  321,  312,  306,  319,  311,  315,    0,  312,
+      318,  332,  335,  332,  293,  297,  308,  309,    0,    0,
+        0,  311,  291,  287,    0,  326,  323,  290,    0,    0,
+
+      300,  291,  300,  297,    0,  301,    0,    0,    0,  295,
+        0,    0,  288,  276,  275,  274,    0,  284,  286,  219,
+      288,  270,    0,  280,  272,  281,    0,  209,    0,  277,
+      264,  285,  221,  284,  253,  256,  253,  208,  240,    0,
+        0,    0,    0,  227,  236,  237,    0,    0,  250,  247,
+      246,  232,  245,  246,    0,  232,  242,  226,  235,  234,
+      213,  219,  198,    0,  195,    0,    0,    0,  195,  187,
+      172,    0,    0,    0,    0,    0,    0,    0,  175,  148,
+        0,  139,    0,  129,    0,   97,   79,    0,  512,  294,
+      300,  306,  312,  315,  318,  113
+
     } ;
 
-static yyconst flex_int16_t yy_def[249] =
+static yyconst flex_int16_t yy_def[397] =
     {   0,
-      241,    1,  242,  242,  241,  241,  241,  241,  241,  243,
-      244,  241,  241,  245,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,   23,   23,  241,  241,  241,  241,  241,
-      241,  246,  241,  241,  241,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  241,  241,  241,  241,  241,  247,  241,  243,
-      241,  243,  244,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,   23,   25,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  241,  247,  241,
-      241,  248,  241,  241,  241,  241,  241,  241,  241,  241,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  241,  241,  241,  241,  241,  241,  241,  241,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-      246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
-        0,  241,  241,  241,  241,  241,  241,  241
+      389,    1,  390,  390,  389,  389,  389,  389,  389,  391,
+      392,  389,  389,  393,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,   23,   23,  389,  389,  389,  389,  389,
+      389,  394,  389,  389,  389,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  389,  389,  389,  389,  389,  395,  389,  391,
+      389,  391,  392,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,   23,   25,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      389,  395,  389,  389,  396,  389,  389,  389,  389,  389,
+      389,  389,  389,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  389,  389,  389,  389,  389,  389,  389,  389,
+
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  266,  394,
+
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  394,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,    0,  389,
+      389,  389,  389,  389,  389,  389
+
     } ;
 
-static yyconst flex_int16_t yy_nxt[403] =
+static yyconst flex_int16_t yy_nxt[579] =
     {   0,
         6,    7,    8,    7,    9,   10,   11,   12,   13,   14,
        15,   16,   17,   18,   19,   20,   21,   22,   23,   24,
@@ -530,48 +579,66 @@ static yyconst flex_int16_t yy_nxt[403] =
        30,   31,   32,   32,   33,    6,   34,   35,    6,   36,
        37,   38,   39,   40,   41,   32,   32,   42,   32,   43,
        44,   32,   45,   46,   47,   48,   49,   50,   51,   52,
-       32,   32,   53,   54,   55,   57,   61,  101,   93,   90,
-       77,   77,   91,   68,  102,   92,   70,   94,  162,   83,
-      163,   58,   58,   58,   58,   58,   58,   58,   58,   69,
-       71,   72,  241,   84,  106,   58,   62,  107,   95,  122,
-
-       96,   98,   58,   58,   58,   58,   58,   58,   57,   97,
-      115,   99,  241,   61,  100,  241,  109,  110,  140,   82,
-       82,  173,  174,  116,   58,   58,   58,   58,   58,   58,
-       58,   58,  112,  141,  138,  160,  113,  240,   58,  161,
-      114,   78,  139,   62,  239,   58,   58,   58,   58,   58,
-       58,   75,  238,   76,   76,   77,   77,   77,   77,   77,
-       77,  237,   82,   82,  118,  122,  122,  122,  122,  122,
-      122,  122,  122,  236,  123,   78,  124,   82,   82,  125,
-      126,  127,   79,  128,   78,  235,  129,  130,  183,  234,
-      184,  233,   80,  185,  186,   81,  232,  231,   82,   78,
-
-      217,  230,  218,  229,  228,  219,  220,   82,  227,  226,
-      225,  224,  223,  222,  221,  216,  215,  214,  213,  212,
-      211,  210,   82,   56,   56,   56,   56,   56,   56,   60,
-       60,   60,   60,   60,   60,   63,  209,  208,   63,   63,
-       63,   66,  207,   66,   66,   66,   66,   87,   87,   87,
-      119,  119,  206,  205,  204,  203,  202,  201,  200,  199,
-      198,  197,  196,  195,  194,  193,  192,  191,  190,  189,
-      188,  187,  182,  181,  180,  179,  178,  177,  176,  175,
-      172,  171,  170,  169,  168,  167,  166,  165,  164,  159,
-      158,  157,  156,  155,  154,  153,  152,  151,  150,  149,
-
-      148,  147,  146,  145,  144,  143,  142,  137,  136,  135,
-      134,  133,  132,  131,  241,  121,  120,  241,  117,  111,
-      108,  105,  104,  103,   89,   88,   86,   85,  241,   74,
-       73,   67,   65,   64,   59,  241,    5,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-
-      241,  241
+       32,   32,   32,   53,   54,   55,   57,   61,   92,   93,
+       98,   77,   77,  108,   68,  151,  186,   70,  109,   99,
+       83,  187,   58,   58,   58,   58,   58,   58,   58,   58,
+       69,   71,   72,  389,   84,  106,   58,   62,  152,  100,
+
+      123,  101,  107,   58,   58,   58,   58,   58,   58,   57,
+      102,  103,   88,  389,   89,  124,  135,  389,   90,   91,
+      112,  104,  388,   61,  105,   58,   58,   58,   58,   58,
+       58,   58,   58,  113,   94,  114,  116,   95,  115,   58,
+       96,  193,  387,  194,   97,  117,   58,   58,   58,   58,
+       58,   58,   75,   62,   76,   76,   77,   77,   77,   77,
+       77,   77,  118,  125,  128,  119,  120,  126,   82,   82,
+      232,  127,  121,   82,   82,  233,   78,  129,  122,  136,
+      386,  137,  385,   79,  138,  139,  140,  384,  141,  157,
+       78,  142,  143,   80,  159,   78,   81,  158,  174,  178,
+
+       82,  135,  135,  135,  135,  135,  135,  135,  135,  160,
+      296,  171,  175,  297,  131,  172,  191,  179,  383,   82,
+      192,   82,   82,  208,  209,  218,  382,  219,  243,  381,
+      220,  221,  244,  266,  266,  266,  266,  266,  266,  266,
+      282,  380,  283,   78,  379,  284,  285,  378,  344,  222,
+      299,  299,  299,  299,  299,  299,  299,  299,  333,  345,
+      334,  346,  335,  350,  356,  357,  222,   82,  336,  359,
+      377,  337,  351,  376,  338,  361,  375,  374,  360,  339,
+      373,  222,  372,  362,  371,  370,  369,  368,  367,  366,
+      365,  364,  358,  363,   56,   56,   56,   56,   56,   56,
+
+       60,   60,   60,   60,   60,   60,   63,  355,  354,   63,
+       63,   63,   66,  353,   66,   66,   66,   66,   87,   87,
+       87,  132,  132,  352,  349,  348,  347,  343,  342,  341,
+      222,  340,  332,  331,  222,  222,  222,  330,  329,  328,
+      327,  326,  325,  324,  323,  322,  322,  222,  321,  320,
+      319,  318,  317,  222,  316,  315,  314,  313,  312,  311,
+      310,  309,  308,  307,  306,  305,  304,  303,  302,  301,
+      300,  222,  222,  222,  298,  295,  294,  293,  292,  291,
+      290,  289,  288,  287,  286,  281,  280,  279,  278,  277,
+      276,  275,  274,  273,  272,  271,  270,  269,  268,  267,
+
+      222,  265,  264,  263,  262,  261,  260,  259,  258,  257,
+      256,  255,  254,  253,  252,  251,  250,  249,  248,  247,
+      246,  245,  242,  241,  240,  239,  238,  237,  236,  235,
+      234,  231,  230,  229,  228,  227,  226,  225,  224,  223,
+      217,  216,  215,  214,  213,  212,  211,  210,  207,  206,
+      205,  204,  203,  202,  201,  200,  199,  198,  197,  196,
+      195,  190,  189,  188,  185,  184,  183,  182,  181,  180,
+      177,  176,  173,  170,  169,  168,  167,  166,  165,  164,
+      163,  162,  161,  156,  155,  154,  153,  150,  149,  148,
+      147,  146,  145,  144,  389,  134,  133,  389,  130,  111,
+
+      110,   86,   85,  389,   74,   73,   67,   65,   64,   59,
+      389,    5,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389
     } ;
 
-static yyconst flex_int16_t yy_chk[403] =
+static yyconst flex_int16_t yy_chk[579] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -579,56 +646,76 @@ static yyconst flex_int16_t yy_chk[403] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    3,   10,   42,   39,   38,
-       25,   25,   38,   18,   42,   38,   20,   39,  122,   28,
-      122,    3,    3,    3,    3,    3,    3,    3,    3,   18,
-       20,   20,   25,   28,   46,    3,   10,   46,   40,  248,
-
-       40,   41,    3,    3,    3,    3,    3,    3,    4,   40,
-       51,   41,   25,   60,   41,   25,   48,   48,   96,   54,
-       54,  135,  135,   51,    4,    4,    4,    4,    4,    4,
-        4,    4,   50,   96,   95,  117,   50,  237,    4,  117,
-       50,   54,   95,   60,  228,    4,    4,    4,    4,    4,
-        4,   23,  227,   23,   23,   23,   23,   23,   23,   23,
-       23,  224,   82,   82,   54,   75,   75,   75,   75,   75,
-       75,   75,   75,  221,   79,   23,   79,  118,  118,   79,
-       79,   80,   23,   80,   82,  219,   80,   80,  146,  218,
-      146,  217,   23,  146,  146,   23,  216,  215,   23,  118,
-
-      194,  214,  194,  213,  212,  194,  194,   82,  208,  205,
-      204,  203,  199,  196,  195,  192,  191,  190,  189,  188,
-      185,  184,  118,  242,  242,  242,  242,  242,  242,  243,
-      243,  243,  243,  243,  243,  244,  183,  182,  244,  244,
-      244,  245,  181,  245,  245,  245,  245,  246,  246,  246,
-      247,  247,  180,  179,  175,  174,  173,  172,  170,  161,
-      160,  159,  157,  156,  155,  154,  153,  152,  151,  150,
-      149,  147,  145,  144,  143,  142,  141,  139,  138,  137,
-      134,  133,  132,  129,  128,  127,  125,  124,  123,  116,
-      115,  114,  113,  112,  111,  110,  109,  108,  107,  106,
-
-      104,  103,  102,  100,   99,   98,   97,   94,   93,   92,
-       91,   90,   89,   88,   76,   73,   66,   62,   52,   49,
-       47,   45,   44,   43,   37,   36,   30,   29,   24,   22,
-       21,   17,   13,   12,    9,    5,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
-
-      241,  241
+        1,    1,    1,    1,    1,    1,    3,   10,   37,   37,
+       39,   25,   25,   43,   18,   95,  126,   20,   43,   39,
+       28,  126,    3,    3,    3,    3,    3,    3,    3,    3,
+       18,   20,   20,   25,   28,   42,    3,   10,   95,   40,
+
+       49,   40,   42,    3,    3,    3,    3,    3,    3,    4,
+       40,   41,   36,   25,   36,   49,  396,   25,   36,   36,
+       46,   41,  387,   60,   41,    4,    4,    4,    4,    4,
+        4,    4,    4,   46,   38,   46,   47,   38,   46,    4,
+       38,  135,  386,  135,   38,   47,    4,    4,    4,    4,
+        4,    4,   23,   60,   23,   23,   23,   23,   23,   23,
+       23,   23,   48,   50,   51,   48,   48,   50,   54,   54,
+      176,   50,   48,   82,   82,  176,   23,   51,   48,   79,
+      384,   79,  382,   23,   79,   79,   80,  380,   80,  100,
+       54,   80,   80,   23,  101,   82,   23,  100,  116,  119,
+
+       23,   75,   75,   75,   75,   75,   75,   75,   75,  101,
+      261,  114,  116,  261,   54,  114,  130,  119,  379,   82,
+      130,  131,  131,  153,  153,  165,  371,  165,  186,  370,
+      165,  165,  186,  222,  222,  222,  222,  222,  222,  222,
+      242,  369,  242,  131,  365,  242,  242,  363,  328,  261,
+      266,  266,  266,  266,  266,  266,  266,  266,  320,  328,
+      320,  328,  320,  333,  338,  338,  165,  131,  320,  344,
+      362,  320,  333,  361,  320,  345,  360,  359,  344,  320,
+      358,  242,  357,  345,  356,  354,  353,  352,  351,  350,
+      349,  346,  339,  345,  390,  390,  390,  390,  390,  390,
+
+      391,  391,  391,  391,  391,  391,  392,  337,  336,  392,
+      392,  392,  393,  335,  393,  393,  393,  393,  394,  394,
+      394,  395,  395,  334,  332,  331,  330,  326,  325,  324,
+      322,  321,  319,  318,  316,  315,  314,  313,  310,  306,
+      304,  303,  302,  301,  298,  297,  296,  294,  293,  292,
+      288,  287,  286,  285,  284,  283,  282,  281,  280,  278,
+      277,  276,  275,  274,  273,  272,  271,  270,  269,  268,
+      267,  265,  264,  263,  262,  259,  258,  257,  252,  251,
+      249,  246,  245,  244,  243,  240,  239,  238,  237,  236,
+      235,  234,  231,  230,  229,  228,  227,  226,  225,  223,
+
+      221,  220,  219,  218,  217,  216,  215,  214,  210,  209,
+      208,  207,  205,  204,  203,  202,  201,  192,  191,  190,
+      188,  187,  185,  184,  183,  182,  181,  180,  179,  178,
+      177,  175,  174,  173,  172,  171,  170,  169,  167,  166,
+      164,  163,  162,  161,  160,  158,  157,  156,  151,  150,
+      149,  148,  147,  146,  144,  142,  141,  140,  138,  137,
+      136,  129,  128,  127,  125,  124,  123,  122,  121,  120,
+      118,  117,  115,  113,  112,  110,  109,  108,  107,  105,
+      104,  103,  102,   99,   98,   97,   96,   94,   93,   92,
+       91,   90,   89,   88,   76,   73,   66,   62,   52,   45,
+
+       44,   30,   29,   24,   22,   21,   17,   13,   12,    9,
+        5,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  389,  389,  389,  389,  389,  389,  389
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[109] =
+static yyconst flex_int32_t yy_rule_can_match_eol[143] =
     {   0,
 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0,     };
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 0,     };
 
 static yy_state_type yy_last_accepting_state;
 static char *yy_last_accepting_cpos;
@@ -668,6 +755,8 @@ char *yytext;
 	#include <grove/Parameter.h>
 
 	#include <string.h>
+	#include <stdlib.h>
+	#include <stdint.h>
 	#include "parser.hh"
 
 	#define SAVELOC(node) node->setLocation(CodeLocation(module->getFile(), \
@@ -678,6 +767,11 @@ char *yytext;
 	#define SAVESTR() yylval.str = new OString(std::string(yytext, yyleng)); SAVELOC(yylval.str);
 	#define CUSTSTR(custom) yylval.str = new OString(custom); SAVELOC(yylval.str);
 
+	// The lane count of a vector type name, which follows its last x, has
+	// the same limit as splat.
+	#define CHECKLANES() if (strtoul(strrchr(yytext, 'x') + 1, nullptr, 10) > \
+		UINT16_MAX) yyerror(module, "Too many lanes in vector type");
+
 	// Get column and stuff for line information
 	int yycolumn = 1;
 	#define YY_USER_ACTION yylloc.first_line = yylloc.last_line = yylineno; yylloc.first_column = yycolumn; yylloc.last_column = yycolumn+yyleng-1; \
@@ -698,7 +792,7 @@ char *yytext;
 #define YY_NO_UNISTD_H 1
 #define YY_NO_INPUT 1
 
-#line 702 "/Users/robert/dev/orange/lib/grove/lexer.cc"
+#line 796 "/Users/robert/dev/orange/lib/grove/lexer.cc"
 
 #define INITIAL 0
 #define HEX 1
@@ -879,10 +973,10 @@ YY_DECL
 	register char *yy_cp, *yy_bp;
 	register int yy_act;
     
-#line 63 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 70 "/Users/robert/dev/orange/lib/grove/lexer.l"
 
 
-#line 886 "/Users/robert/dev/orange/lib/grove/lexer.cc"
+#line 980 "/Users/robert/dev/orange/lib/grove/lexer.cc"
 
 	if ( !(yy_init) )
 		{
@@ -935,13 +1029,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 242 )
+				if ( yy_current_state >= 390 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 241 );
+		while ( yy_current_state != 389 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -973,554 +1067,724 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 65 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 72 "/Users/robert/dev/orange/lib/grove/lexer.l"
 ;
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 67 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 74 "/Users/robert/dev/orange/lib/grove/lexer.l"
 yycolumn = 1; // Reset column as we're on a new line.
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 69 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 76 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL_BASE(UIntType::get(64), 2); return VALUE;
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 71 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 78 "/Users/robert/dev/orange/lib/grove/lexer.l"
 BEGIN(HEX);
 	YY_BREAK
 
 case 5:
 YY_RULE_SETUP
-#line 73 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 80 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL_BASE(UIntType::get(64), 16); BEGIN(INITIAL); return VALUE;
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 74 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 81 "/Users/robert/dev/orange/lib/grove/lexer.l"
 yyerror(module, "Invalid hex constant"); BEGIN(INITIAL);
 	YY_BREAK
 
 case 7:
 YY_RULE_SETUP
-#line 77 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 84 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(FloatType::get()); return VALUE;
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 78 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 85 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(DoubleType::get()); return VALUE;
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 79 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 86 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(DoubleType::get()); return VALUE;
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 81 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 88 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(UIntType::get(8)); return VALUE;
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 82 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 89 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(IntType::get(8)); return VALUE;
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 83 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 90 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(UIntType::get(16)); return VALUE;
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 84 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 91 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(IntType::get(16)); return VALUE;
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 85 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 92 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(UIntType::get(32)); return VALUE;
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 86 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 93 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(IntType::get(32)); return VALUE;
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 87 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 94 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(UIntType::get(64)); return VALUE;
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 88 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 95 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(IntType::get(64)); return VALUE;
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 89 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 96 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(UIntType::get(64)); return VALUE;
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 90 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 97 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(IntType::get(64)); return VALUE;
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 91 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 98 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(IntType::get(64)); return VALUE;
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 93 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 100 "/Users/robert/dev/orange/lib/grove/lexer.l"
 yylval.val = new Value(yytext[1]); return VALUE;
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 95 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 102 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(BoolType::get()); return VALUE;
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 96 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 103 "/Users/robert/dev/orange/lib/grove/lexer.l"
 CREATE_VAL(BoolType::get()); return VALUE;
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 98 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 105 "/Users/robert/dev/orange/lib/grove/lexer.l"
 SAVESTR(); return DEF;
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 99 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 106 "/Users/robert/dev/orange/lib/grove/lexer.l"
 SAVESTR(); return RETURN;
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 100 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return ELIF;
+#line 107 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TAILCALL;
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 101 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return ELSE;
+#line 108 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return ELIF;
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 102 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return END;
+#line 109 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return ELSE;
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 103 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return IF;
+#line 110 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return END;
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 104 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return FOR;
+#line 111 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return IF;
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 105 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return FOREVER;
+#line 112 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return FOR;
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 106 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return LOOP;
+#line 113 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return FOREVER;
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 107 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return CONTINUE;
+#line 114 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return LOOP;
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 108 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return BREAK;
+#line 115 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return CONTINUE;
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 109 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return DO;
+#line 116 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return BREAK;
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 110 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return WHILE;
+#line 117 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return DO;
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 111 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return WHEN;
+#line 118 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return WHILE;
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 112 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return UNLESS;
+#line 119 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return WHEN;
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 113 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return CLASS;
+#line 120 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return SWITCH;
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 114 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return USING;
+#line 121 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return PARALLEL;
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 115 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return PUBLIC;
+#line 122 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return UNLESS;
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 116 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return PRIVATE;
+#line 123 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return CLASS;
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 117 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return SHARED;
+#line 124 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return USING;
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 118 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return EXTERN;
+#line 125 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return PUBLIC;
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 119 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return CONST_FLAG;
+#line 126 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return PRIVATE;
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 120 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return ENUM;
+#line 127 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return SHARED;
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 122 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_VAR;
+#line 128 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return EXTERN;
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 123 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_CHAR;
+#line 129 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return CONST_FLAG;
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 124 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_INT;
+#line 130 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return ALIGN;
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 125 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_UINT;
+#line 131 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return ENUM;
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 126 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_FLOAT;
+#line 133 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_VAR;
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 127 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_DOUBLE;
+#line 134 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_CHAR;
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 128 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_INT8;
+#line 135 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_INT;
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 129 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_UINT8;
+#line 136 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_UINT;
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 130 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_INT16;
+#line 137 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_FLOAT;
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 131 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_UINT16;
+#line 138 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_DOUBLE;
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
-#line 132 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_INT32;
+#line 139 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_INT8;
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-#line 133 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_UINT32;
+#line 140 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_UINT8;
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
-#line 134 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_INT64;
+#line 141 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_INT16;
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
-#line 135 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_UINT64;
+#line 142 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_UINT16;
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 136 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_VOID;
+#line 143 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_INT32;
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
-#line 138 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return OPEN_PAREN;
+#line 144 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_UINT32;
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-#line 139 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return CLOSE_PAREN;
+#line 145 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_INT64;
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-#line 140 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return OPEN_BRACE;
+#line 146 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_UINT64;
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 141 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return CLOSE_BRACE;
+#line 147 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_VOID;
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-#line 142 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return OPEN_BRACKET;
+#line 148 "/Users/robert/dev/orange/lib/grove/lexer.l"
+CHECKLANES(); SAVESTR(); return TYPE_VECTOR;
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-#line 143 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return CLOSE_BRACKET;
+#line 150 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return OPEN_PAREN;
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-#line 145 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return VARARG;
+#line 151 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return CLOSE_PAREN;
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 147 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return INCREMENT;
+#line 152 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return OPEN_BRACE;
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-#line 148 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return DECREMENT;
+#line 153 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return CLOSE_BRACE;
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 150 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return NEQUALS;
+#line 154 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return OPEN_BRACKET;
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 151 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return EQUALS;
+#line 155 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return CLOSE_BRACKET;
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-#line 153 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return LOGICAL_AND;
+#line 157 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return VARARG;
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-#line 154 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return LOGICAL_OR;
+#line 159 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INCREMENT;
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-#line 155 "/Users/robert/dev/orange/lib/grove/lexer.l"
-CUSTSTR("&&"); return LOGICAL_AND;
+#line 160 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return DECREMENT;
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-#line 156 "/Users/robert/dev/orange/lib/grove/lexer.l"
-CUSTSTR("||"); return LOGICAL_OR;
+#line 162 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return NEQUALS;
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
-#line 158 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return BITWISE_AND;
+#line 163 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return EQUALS;
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
-#line 159 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return BITWISE_OR;
+#line 165 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return LOGICAL_AND;
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
-#line 160 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return BITWISE_XOR;
+#line 166 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return LOGICAL_OR;
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
-#line 162 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return ASSIGN;
+#line 167 "/Users/robert/dev/orange/lib/grove/lexer.l"
+CUSTSTR("&&"); return LOGICAL_AND;
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
-#line 163 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return PLUS_ASSIGN;
+#line 168 "/Users/robert/dev/orange/lib/grove/lexer.l"
+CUSTSTR("||"); return LOGICAL_OR;
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
-#line 164 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return MINUS_ASSIGN;
+#line 170 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return BITWISE_AND;
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
-#line 165 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TIMES_ASSIGN;
+#line 171 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return BITWISE_OR;
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
-#line 166 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return DIVIDE_ASSIGN;
+#line 172 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return BITWISE_XOR;
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
-#line 167 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return MOD_ASSIGN;
+#line 174 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return ASSIGN;
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
-#line 169 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return ARROW;
+#line 175 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return PLUS_ASSIGN;
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
-#line 170 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return ARROW_LEFT;
+#line 176 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return MINUS_ASSIGN;
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
-#line 171 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return DOT;
+#line 177 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TIMES_ASSIGN;
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
-#line 172 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return SEMICOLON;
+#line 178 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return DIVIDE_ASSIGN;
 	YY_BREAK
 case 90:
-/* rule 90 can match eol */
 YY_RULE_SETUP
-#line 173 "/Users/robert/dev/orange/lib/grove/lexer.l"
-yycolumn = 1; return NEWLINE; // Reset column as we're on a new line.
+#line 179 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return MOD_ASSIGN;
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
-#line 174 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return COMMA;
+#line 181 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return ARROW;
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
-#line 176 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return LEQ;
+#line 182 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return ARROW_LEFT;
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
-#line 177 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return GEQ;
+#line 183 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return DOT;
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
-#line 179 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return COMP_LT;
+#line 184 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return SEMICOLON;
 	YY_BREAK
 case 95:
+/* rule 95 can match eol */
 YY_RULE_SETUP
-#line 180 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return COMP_GT;
+#line 185 "/Users/robert/dev/orange/lib/grove/lexer.l"
+yycolumn = 1; return NEWLINE; // Reset column as we're on a new line.
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
-#line 182 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return PLUS;
+#line 186 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return COMMA;
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
-#line 183 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return MINUS;
+#line 188 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return LEQ;
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
-#line 184 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TIMES;
+#line 189 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return GEQ;
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
-#line 185 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return DIVIDE;
+#line 191 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return COMP_LT;
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
-#line 186 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return MOD;
+#line 192 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return COMP_GT;
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
-#line 188 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return QUESTION;
+#line 194 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return PLUS;
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
-#line 189 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return COLON;
+#line 195 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return MINUS;
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
-#line 191 "/Users/robert/dev/orange/lib/grove/lexer.l"
-CUSTSTR("%"); return MOD;
+#line 196 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TIMES;
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
-#line 193 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return SIZEOF;
+#line 197 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return DIVIDE;
 	YY_BREAK
 case 105:
-/* rule 105 can match eol */
 YY_RULE_SETUP
-#line 195 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return STRING;
+#line 198 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return MOD;
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
-#line 196 "/Users/robert/dev/orange/lib/grove/lexer.l"
-SAVESTR(); return TYPE_ID;
+#line 200 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return QUESTION;
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
-#line 198 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 201 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return COLON;
+	YY_BREAK
+case 108:
+YY_RULE_SETUP
+#line 203 "/Users/robert/dev/orange/lib/grove/lexer.l"
+CUSTSTR("%"); return MOD;
+	YY_BREAK
+case 109:
+YY_RULE_SETUP
+#line 205 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return SIZEOF;
+	YY_BREAK
+case 110:
+YY_RULE_SETUP
+#line 207 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 111:
+YY_RULE_SETUP
+#line 208 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 112:
+YY_RULE_SETUP
+#line 209 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 113:
+YY_RULE_SETUP
+#line 210 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 114:
+YY_RULE_SETUP
+#line 211 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 115:
+YY_RULE_SETUP
+#line 212 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 116:
+YY_RULE_SETUP
+#line 213 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 117:
+YY_RULE_SETUP
+#line 214 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 118:
+YY_RULE_SETUP
+#line 215 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 119:
+YY_RULE_SETUP
+#line 216 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 120:
+YY_RULE_SETUP
+#line 217 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 121:
+YY_RULE_SETUP
+#line 218 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 122:
+YY_RULE_SETUP
+#line 219 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 123:
+YY_RULE_SETUP
+#line 220 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 124:
+YY_RULE_SETUP
+#line 221 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 125:
+YY_RULE_SETUP
+#line 222 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 126:
+YY_RULE_SETUP
+#line 223 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 127:
+YY_RULE_SETUP
+#line 224 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 128:
+YY_RULE_SETUP
+#line 225 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 129:
+YY_RULE_SETUP
+#line 226 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 130:
+YY_RULE_SETUP
+#line 227 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 131:
+YY_RULE_SETUP
+#line 228 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 132:
+YY_RULE_SETUP
+#line 229 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 133:
+YY_RULE_SETUP
+#line 230 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 134:
+YY_RULE_SETUP
+#line 231 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 135:
+YY_RULE_SETUP
+#line 232 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 136:
+YY_RULE_SETUP
+#line 233 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 137:
+YY_RULE_SETUP
+#line 234 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 138:
+YY_RULE_SETUP
+#line 235 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return INTRINSIC;
+	YY_BREAK
+case 139:
+/* rule 139 can match eol */
+YY_RULE_SETUP
+#line 237 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return STRING;
+	YY_BREAK
+case 140:
+YY_RULE_SETUP
+#line 238 "/Users/robert/dev/orange/lib/grove/lexer.l"
+SAVESTR(); return TYPE_ID;
+	YY_BREAK
+case 141:
+YY_RULE_SETUP
+#line 240 "/Users/robert/dev/orange/lib/grove/lexer.l"
 yyerror(module, "invalid token");
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(HEX):
-#line 200 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 242 "/Users/robert/dev/orange/lib/grove/lexer.l"
 { return yyonce++ ? 0 : NEWLINE; }
 	YY_BREAK
-case 108:
+case 142:
 YY_RULE_SETUP
-#line 202 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 244 "/Users/robert/dev/orange/lib/grove/lexer.l"
 ECHO;
 	YY_BREAK
-#line 1524 "/Users/robert/dev/orange/lib/grove/lexer.cc"
+#line 1788 "/Users/robert/dev/orange/lib/grove/lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -1811,7 +2075,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 242 )
+			if ( yy_current_state >= 390 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -1839,11 +2103,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 242 )
+		if ( yy_current_state >= 390 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 241);
+	yy_is_jam = (yy_current_state == 389);
 
 	return yy_is_jam ? 0 : yy_current_state;
 }
@@ -2483,7 +2747,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 202 "/Users/robert/dev/orange/lib/grove/lexer.l"
+#line 244 "/Users/robert/dev/orange/lib/grove/lexer.l"
 
 
 
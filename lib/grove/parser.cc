@@ -148,7 +148,13 @@
      QUESTION = 337,
      COLON = 338,
      ENUM = 339,
-     SIZEOF = 340
+     SIZEOF = 340,
+     SWITCH = 341,
+     PARALLEL = 342,
+     TAILCALL = 343,
+     INTRINSIC = 344,
+     ALIGN = 345,
+     TYPE_VECTOR = 346
    };
 #endif
 /* Tokens.  */
@@ -235,6 +241,12 @@
 #define COLON 338
 #define ENUM 339
 #define SIZEOF 340
+#define SWITCH 341
+#define PARALLEL 342
+#define TAILCALL 343
+#define INTRINSIC 344
+#define ALIGN 345
+#define TYPE_VECTOR 346
 
 
 
@@ -248,7 +260,10 @@
 	#include <grove/CondBlock.h>
 	#include <grove/Function.h>
 	#include <grove/IfStmt.h>
+	#include <grove/SwitchStmt.h>
+	#include <grove/CaseBlock.h>
 	#include <grove/FunctionCall.h>
+	#include <grove/ComptimeCall.h>
 	#include <grove/ExternFunction.h>
 	#include <grove/Value.h>
 	#include <grove/StrValue.h>
@@ -265,6 +280,7 @@
 	#include <grove/IncrementExpr.h>
 	#include <grove/Loop.h>
 	#include <grove/LoopTerminator.h>
+	#include <grove/ParallelLoop.h>
 	#include <grove/DerefExpr.h>
 	#include <grove/ReferenceExpr.h>
 	#include <grove/CastExpr.h>
@@ -274,6 +290,7 @@
 	#include <grove/AccessExpr.h>
 	#include <grove/EnumStmt.h>
 	#include <grove/SizeofExpr.h>
+	#include <grove/BuiltinExpr.h>
 	#include <grove/OString.h>
 
 	#include <grove/types/Type.h>
@@ -286,6 +303,7 @@
 	#include <grove/types/VarType.h>
 	#include <grove/types/ArrayType.h>
 	#include <grove/types/VariadicArrayType.h>
+	#include <grove/types/VectorType.h>
 
 	#include <util/assertions.h>
 
@@ -319,7 +337,7 @@
 
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 typedef union YYSTYPE
-#line 72 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 78 "/Users/robert/dev/orange/lib/grove/parser.y"
 {
 	std::vector<ASTNode*>* nodes;
 	std::vector<Parameter*>* params;
@@ -328,6 +346,7 @@ typedef union YYSTYPE
 	std::vector<Expression*>* exprs;
 	std::vector<std::tuple<OString, Expression*>>* pairs;
 	std::vector<std::tuple<OString, Value*>>* vpairs;
+	std::vector<OString>* strs;
 	ASTNode* node;
 	Block* block;
 	Expression* expr;
@@ -337,7 +356,7 @@ typedef union YYSTYPE
 	Type* ty;
 }
 /* Line 193 of yacc.c.  */
-#line 341 "/Users/robert/dev/orange/lib/grove/parser.cc"
+#line 360 "/Users/robert/dev/orange/lib/grove/parser.cc"
 	YYSTYPE;
 # define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
@@ -362,7 +381,7 @@ typedef struct YYLTYPE
 
 
 /* Line 216 of yacc.c.  */
-#line 366 "/Users/robert/dev/orange/lib/grove/parser.cc"
+#line 385 "/Users/robert/dev/orange/lib/grove/parser.cc"
 
 #ifdef short
 # undef short
@@ -577,22 +596,22 @@ union yyalloc
 #endif
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  94
+#define YYFINAL  108
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1887
+#define YYLAST   2462
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  86
+#define YYNTOKENS  92
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  43
+#define YYNNTS  47
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  152
+#define YYNRULES  170
 /* YYNRULES -- Number of states.  */
-#define YYNSTATES  307
+#define YYNSTATES  368
 
 /* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   340
+#define YYMAXUTOK   346
 
 #define YYTRANSLATE(YYX)						\
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -634,7 +653,7 @@ static const yytype_uint8 yytranslate[] =
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
       65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
       75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85
+      85,    86,    87,    88,    89,    90,    91
 };
 
 #if YYDEBUG
@@ -644,100 +663,113 @@ static const yytype_uint16 yyprhs[] =
 {
        0,     0,     3,     5,     8,    11,    13,    15,    17,    18,
       21,    24,    27,    29,    32,    34,    36,    38,    40,    42,
-      44,    46,    48,    50,    52,    54,    63,    73,    76,    77,
-      84,    92,   102,   108,   114,   119,   121,   127,   131,   135,
-     139,   143,   155,   161,   167,   174,   184,   194,   198,   202,
-     205,   208,   210,   211,   213,   214,   219,   222,   226,   228,
-     230,   232,   234,   236,   238,   240,   242,   244,   246,   248,
-     252,   256,   260,   264,   268,   272,   276,   280,   284,   288,
-     292,   296,   300,   304,   308,   312,   316,   320,   324,   328,
-     332,   336,   339,   342,   345,   348,   354,   358,   363,   367,
-     369,   372,   374,   376,   379,   382,   387,   391,   396,   400,
-     405,   410,   414,   416,   418,   421,   424,   428,   434,   436,
-     440,   446,   450,   456,   459,   464,   466,   469,   471,   473,
-     477,   480,   482,   485,   487,   489,   492,   497,   501,   503,
-     505,   507,   509,   511,   513,   515,   517,   519,   521,   523,
-     525,   527,   529
+      44,    46,    48,    50,    52,    54,    56,    66,    77,    80,
+      81,    84,    85,    92,   100,   110,   116,   122,   127,   129,
+     135,   144,   150,   155,   161,   165,   169,   173,   177,   190,
+     197,   203,   210,   224,   234,   244,   248,   252,   255,   258,
+     264,   267,   268,   270,   271,   273,   274,   279,   282,   286,
+     288,   290,   292,   294,   296,   298,   300,   302,   304,   306,
+     308,   312,   316,   320,   324,   328,   332,   336,   340,   344,
+     348,   352,   356,   360,   364,   368,   372,   376,   380,   384,
+     388,   392,   396,   399,   402,   405,   408,   414,   418,   423,
+     428,   434,   438,   440,   443,   445,   447,   450,   453,   458,
+     462,   467,   471,   476,   481,   485,   490,   494,   496,   498,
+     501,   505,   508,   515,   519,   525,   527,   531,   537,   541,
+     547,   550,   555,   557,   560,   562,   564,   568,   571,   573,
+     576,   578,   580,   583,   588,   592,   594,   596,   598,   600,
+     602,   604,   606,   608,   610,   612,   614,   616,   618,   620,
+     622
 };
 
 /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
 static const yytype_int16 yyrhs[] =
 {
-      87,     0,    -1,    88,    -1,    88,    90,    -1,    88,    91,
-      -1,    90,    -1,    91,    -1,    88,    -1,    -1,    93,   123,
-      -1,   108,   123,    -1,   109,   123,    -1,   123,    -1,   118,
-     123,    -1,   118,    -1,   109,    -1,    94,    -1,    96,    -1,
-      97,    -1,    99,    -1,   100,    -1,   101,    -1,   102,    -1,
-     103,    -1,   120,    -1,     3,     8,     9,    10,    95,   123,
-      89,     4,    -1,     3,     8,     9,   106,    10,    95,   123,
-      89,     4,    -1,    53,   125,    -1,    -1,    63,     8,     9,
-      10,    53,   125,    -1,    63,     8,     9,   106,    10,    53,
-     125,    -1,    63,     8,     9,   106,    12,    64,    10,    53,
-     125,    -1,     5,   109,   123,    88,    98,    -1,     6,   109,
-     123,    88,    98,    -1,     7,   123,    88,     4,    -1,     4,
-      -1,    68,   109,   123,    88,     4,    -1,   108,     5,   109,
-      -1,   109,     5,   109,    -1,   108,    68,   109,    -1,   109,
-      68,   109,    -1,    74,     9,   104,    19,   105,    19,   105,
-      10,   123,    88,     4,    -1,    80,   109,   123,    88,     4,
-      -1,    75,    79,   123,    88,     4,    -1,    79,   123,    88,
-       4,    80,   109,    -1,   108,    74,     9,   104,    19,   105,
-      19,   105,    10,    -1,   109,    74,     9,   104,    19,   105,
-      19,   105,    10,    -1,   108,    80,   109,    -1,   109,    80,
-     109,    -1,   108,    75,    -1,   109,    75,    -1,    92,    -1,
-      -1,   109,    -1,    -1,   106,    12,   125,     8,    -1,   125,
-       8,    -1,   107,    12,   109,    -1,   109,    -1,   117,    -1,
-      77,    -1,    78,    -1,    76,    -1,   115,    -1,   110,    -1,
-     111,    -1,   114,    -1,   112,    -1,   113,    -1,   109,    58,
-     109,    -1,   109,    59,   109,    -1,   109,    56,   109,    -1,
-     109,    57,   109,    -1,   109,    65,   109,    -1,   109,    66,
-     109,    -1,   109,    69,   109,    -1,   109,    70,   109,    -1,
-     109,    17,   109,    -1,   109,    16,   109,    -1,   109,    13,
-     109,    -1,   109,    15,   109,    -1,   109,    60,   109,    -1,
-     109,    71,   109,    -1,   109,    72,   109,    -1,   109,    73,
-     109,    -1,   109,    47,   109,    -1,   109,    48,   109,    -1,
-     109,    49,   109,    -1,   109,    50,   109,    -1,   109,    51,
-     109,    -1,   109,    52,   109,    -1,   109,    45,    -1,   109,
-      46,    -1,    45,   109,    -1,    46,   109,    -1,   109,    82,
-     109,    83,   109,    -1,     8,     9,    10,    -1,     8,     9,
-     107,    10,    -1,     9,   109,    10,    -1,    61,    -1,    16,
-     109,    -1,    62,    -1,     8,    -1,    13,   109,    -1,    71,
-     109,    -1,     9,   125,    10,   109,    -1,    43,   116,    44,
-      -1,   109,    43,   109,    44,    -1,   109,    55,     8,    -1,
-      85,     9,   109,    10,    -1,    85,     9,   125,    10,    -1,
-     116,    12,   109,    -1,   109,    -1,    35,    -1,    35,   109,
-      -1,   125,   119,    -1,   119,    12,     8,    -1,   119,    12,
-       8,    47,   109,    -1,     8,    -1,     8,    47,   109,    -1,
-      84,     8,   123,   121,     4,    -1,   121,     8,   123,    -1,
-     121,     8,    47,   122,   123,    -1,     8,   123,    -1,     8,
-      47,   122,   123,    -1,    61,    -1,    16,    61,    -1,    18,
-      -1,    19,    -1,   124,    43,    44,    -1,   125,    13,    -1,
-     128,    -1,    81,   125,    -1,   126,    -1,   124,    -1,   124,
-     127,    -1,   127,    43,   109,    44,    -1,    43,   109,    44,
-      -1,    20,    -1,    21,    -1,    22,    -1,    23,    -1,    24,
-      -1,    26,    -1,    28,    -1,    30,    -1,    25,    -1,    27,
-      -1,    29,    -1,    31,    -1,    32,    -1,    33,    -1,    34,
-      -1
+      93,     0,    -1,    94,    -1,    94,    96,    -1,    94,    97,
+      -1,    96,    -1,    97,    -1,    94,    -1,    -1,    99,   133,
+      -1,   118,   133,    -1,   119,   133,    -1,   133,    -1,   128,
+     133,    -1,   128,    -1,   119,    -1,   100,    -1,   103,    -1,
+     104,    -1,   108,    -1,   109,    -1,   110,    -1,   111,    -1,
+     112,    -1,   130,    -1,   106,    -1,     3,     8,     9,    10,
+     102,   101,   133,    95,     4,    -1,     3,     8,     9,   116,
+      10,   102,   101,   133,    95,     4,    -1,   101,     8,    -1,
+      -1,    53,   135,    -1,    -1,    63,     8,     9,    10,    53,
+     135,    -1,    63,     8,     9,   116,    10,    53,   135,    -1,
+      63,     8,     9,   116,    12,    64,    10,    53,   135,    -1,
+       5,   119,   133,    94,   105,    -1,     6,   119,   133,    94,
+     105,    -1,     7,   133,    94,     4,    -1,     4,    -1,    86,
+     119,   133,   107,     4,    -1,    86,   119,   133,   107,     7,
+     133,    95,     4,    -1,   107,    67,   126,   133,    95,    -1,
+      67,   126,   133,    95,    -1,    68,   119,   133,    94,     4,
+      -1,   118,     5,   119,    -1,   119,     5,   119,    -1,   118,
+      68,   119,    -1,   119,    68,   119,    -1,    74,     9,   114,
+      19,   115,    19,   115,    10,   113,   133,    94,     4,    -1,
+      80,   119,   113,   133,    94,     4,    -1,    75,    79,   133,
+      94,     4,    -1,    79,   133,    94,     4,    80,   119,    -1,
+      87,    74,     9,    98,    19,   119,    19,   119,    10,   113,
+     133,    94,     4,    -1,   118,    74,     9,   114,    19,   115,
+      19,   115,    10,    -1,   119,    74,     9,   114,    19,   115,
+      19,   115,    10,    -1,   118,    80,   119,    -1,   119,    80,
+     119,    -1,   118,    75,    -1,   119,    75,    -1,   113,     8,
+       9,    61,    10,    -1,   113,     8,    -1,    -1,    98,    -1,
+      -1,   119,    -1,    -1,   116,    12,   135,     8,    -1,   135,
+       8,    -1,   117,    12,   119,    -1,   119,    -1,   127,    -1,
+      77,    -1,    78,    -1,    76,    -1,   125,    -1,   120,    -1,
+     121,    -1,   124,    -1,   122,    -1,   123,    -1,   119,    58,
+     119,    -1,   119,    59,   119,    -1,   119,    56,   119,    -1,
+     119,    57,   119,    -1,   119,    65,   119,    -1,   119,    66,
+     119,    -1,   119,    69,   119,    -1,   119,    70,   119,    -1,
+     119,    17,   119,    -1,   119,    16,   119,    -1,   119,    13,
+     119,    -1,   119,    15,   119,    -1,   119,    60,   119,    -1,
+     119,    71,   119,    -1,   119,    72,   119,    -1,   119,    73,
+     119,    -1,   119,    47,   119,    -1,   119,    48,   119,    -1,
+     119,    49,   119,    -1,   119,    50,   119,    -1,   119,    51,
+     119,    -1,   119,    52,   119,    -1,   119,    45,    -1,   119,
+      46,    -1,    45,   119,    -1,    46,   119,    -1,   119,    82,
+     119,    83,   119,    -1,     8,     9,    10,    -1,     8,     9,
+     117,    10,    -1,    81,     8,     9,    10,    -1,    81,     8,
+       9,   117,    10,    -1,     9,   119,    10,    -1,    61,    -1,
+      16,   119,    -1,    62,    -1,     8,    -1,    13,   119,    -1,
+      71,   119,    -1,     9,   135,    10,   119,    -1,    43,   126,
+      44,    -1,   119,    43,   119,    44,    -1,   119,    55,     8,
+      -1,    85,     9,   119,    10,    -1,    85,     9,   135,    10,
+      -1,    89,     9,    10,    -1,    89,     9,   117,    10,    -1,
+     126,    12,   119,    -1,   119,    -1,    35,    -1,    35,   119,
+      -1,    35,    88,   119,    -1,   135,   129,    -1,    90,     9,
+      61,    10,   135,   129,    -1,   129,    12,     8,    -1,   129,
+      12,     8,    47,   119,    -1,     8,    -1,     8,    47,   119,
+      -1,    84,     8,   133,   131,     4,    -1,   131,     8,   133,
+      -1,   131,     8,    47,   132,   133,    -1,     8,   133,    -1,
+       8,    47,   132,   133,    -1,    61,    -1,    16,    61,    -1,
+      18,    -1,    19,    -1,   134,    43,    44,    -1,   135,    13,
+      -1,   138,    -1,    81,   135,    -1,   136,    -1,   134,    -1,
+     134,   137,    -1,   137,    43,   119,    44,    -1,    43,   119,
+      44,    -1,    20,    -1,    21,    -1,    22,    -1,    23,    -1,
+      24,    -1,    26,    -1,    28,    -1,    30,    -1,    25,    -1,
+      27,    -1,    29,    -1,    31,    -1,    32,    -1,    33,    -1,
+      34,    -1,    91,    -1
 };
 
 /* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   150,   150,   162,   171,   183,   192,   207,   208,   212,
-     213,   214,   215,   219,   226,   230,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,   249,   265,   285,   286,   290,
-     298,   306,   317,   344,   360,   376,   383,   401,   412,   426,
-     437,   451,   467,   481,   495,   512,   522,   532,   539,   546,
-     553,   563,   564,   568,   569,   573,   582,   593,   598,   605,
-     606,   607,   608,   612,   613,   614,   615,   616,   617,   621,
-     622,   623,   624,   625,   626,   628,   629,   633,   634,   635,
-     636,   637,   639,   640,   641,   643,   644,   645,   646,   647,
-     648,   652,   653,   654,   655,   659,   667,   675,   686,   687,
-     688,   689,   690,   691,   692,   693,   694,   695,   696,   697,
-     698,   702,   707,   716,   721,   729,   745,   752,   759,   766,
-     775,   791,   796,   801,   807,   815,   820,   829,   830,   834,
-     838,   842,   849,   853,   857,   864,   899,   904,   912,   913,
-     914,   915,   916,   917,   918,   919,   920,   921,   922,   923,
-     924,   925,   926
+       0,   159,   159,   171,   180,   192,   201,   216,   217,   221,
+     222,   223,   224,   228,   235,   239,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,   255,   259,   282,   309,   315,
+     319,   320,   324,   332,   340,   351,   378,   394,   410,   417,
+     430,   456,   472,   491,   509,   520,   534,   545,   559,   582,
+     603,   617,   631,   657,   667,   677,   684,   691,   698,   708,
+     715,   721,   725,   726,   730,   731,   735,   744,   755,   760,
+     767,   768,   769,   770,   774,   775,   776,   777,   778,   779,
+     783,   784,   785,   786,   787,   788,   790,   791,   795,   796,
+     797,   798,   799,   801,   802,   803,   805,   806,   807,   808,
+     809,   810,   814,   815,   816,   817,   821,   829,   837,   845,
+     856,   870,   871,   872,   873,   874,   875,   876,   877,   878,
+     879,   880,   881,   882,   883,   889,   899,   904,   913,   918,
+     923,   931,   944,   963,   970,   977,   984,   993,  1009,  1014,
+    1019,  1025,  1033,  1038,  1047,  1048,  1052,  1056,  1060,  1067,
+    1071,  1075,  1082,  1117,  1122,  1130,  1131,  1132,  1133,  1134,
+    1135,  1136,  1137,  1138,  1139,  1140,  1141,  1142,  1143,  1144,
+    1145
 };
 #endif
 
@@ -760,10 +792,12 @@ static const char *const yytname[] =
   "NEQUALS", "WHEN", "UNLESS", "LOGICAL_AND", "LOGICAL_OR", "BITWISE_AND",
   "BITWISE_OR", "BITWISE_XOR", "FOR", "FOREVER", "LOOP", "CONTINUE",
   "BREAK", "DO", "WHILE", "CONST_FLAG", "QUESTION", "COLON", "ENUM",
-  "SIZEOF", "$accept", "start", "statements", "opt_statements",
+  "SIZEOF", "SWITCH", "PARALLEL", "TAILCALL", "INTRINSIC", "ALIGN",
+  "TYPE_VECTOR", "$accept", "start", "statements", "opt_statements",
   "statement", "compound_statement", "valued", "structures", "function",
-  "type_hint", "extern_function", "ifs", "else_if_or_end", "unless",
-  "inline_if", "inline_unless", "for_loop", "inline_for_loop",
+  "opt_function_attrs", "type_hint", "extern_function", "ifs",
+  "else_if_or_end", "switch_stmt", "switch_cases", "unless", "inline_if",
+  "inline_unless", "for_loop", "inline_for_loop", "opt_loop_hints",
   "opt_valued", "opt_expression", "param_list", "arg_list", "controls",
   "expression", "comparison", "arithmetic", "increment", "ternary", "call",
   "primary", "expr_list", "return", "var_decl", "var_decl_list",
@@ -785,29 +819,32 @@ static const yytype_uint16 yytoknum[] =
      305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
      315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
      325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346
 };
 # endif
 
 /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,    86,    87,    88,    88,    88,    88,    89,    89,    90,
-      90,    90,    90,    91,    92,    92,    93,    93,    93,    93,
-      93,    93,    93,    93,    93,    94,    94,    95,    95,    96,
-      96,    96,    97,    98,    98,    98,    99,   100,   100,   101,
-     101,   102,   102,   102,   102,   103,   103,   103,   103,   103,
-     103,   104,   104,   105,   105,   106,   106,   107,   107,   108,
-     108,   108,   108,   109,   109,   109,   109,   109,   109,   110,
-     110,   110,   110,   110,   110,   110,   110,   111,   111,   111,
-     111,   111,   111,   111,   111,   111,   111,   111,   111,   111,
-     111,   112,   112,   112,   112,   113,   114,   114,   115,   115,
-     115,   115,   115,   115,   115,   115,   115,   115,   115,   115,
-     115,   116,   116,   117,   117,   118,   119,   119,   119,   119,
-     120,   121,   121,   121,   121,   122,   122,   123,   123,   124,
-     124,   124,   125,   125,   125,   126,   127,   127,   128,   128,
-     128,   128,   128,   128,   128,   128,   128,   128,   128,   128,
-     128,   128,   128
+       0,    92,    93,    94,    94,    94,    94,    95,    95,    96,
+      96,    96,    96,    97,    98,    98,    99,    99,    99,    99,
+      99,    99,    99,    99,    99,    99,   100,   100,   101,   101,
+     102,   102,   103,   103,   103,   104,   105,   105,   105,   106,
+     106,   107,   107,   108,   109,   109,   110,   110,   111,   111,
+     111,   111,   111,   112,   112,   112,   112,   112,   112,   113,
+     113,   113,   114,   114,   115,   115,   116,   116,   117,   117,
+     118,   118,   118,   118,   119,   119,   119,   119,   119,   119,
+     120,   120,   120,   120,   120,   120,   120,   120,   121,   121,
+     121,   121,   121,   121,   121,   121,   121,   121,   121,   121,
+     121,   121,   122,   122,   122,   122,   123,   124,   124,   124,
+     124,   125,   125,   125,   125,   125,   125,   125,   125,   125,
+     125,   125,   125,   125,   125,   125,   126,   126,   127,   127,
+     127,   128,   128,   129,   129,   129,   129,   130,   131,   131,
+     131,   131,   132,   132,   133,   133,   134,   134,   134,   135,
+     135,   135,   136,   137,   137,   138,   138,   138,   138,   138,
+     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
+     138
 };
 
 /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
@@ -815,20 +852,22 @@ static const yytype_uint8 yyr2[] =
 {
        0,     2,     1,     2,     2,     1,     1,     1,     0,     2,
        2,     2,     1,     2,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     8,     9,     2,     0,     6,
-       7,     9,     5,     5,     4,     1,     5,     3,     3,     3,
-       3,    11,     5,     5,     6,     9,     9,     3,     3,     2,
-       2,     1,     0,     1,     0,     4,     2,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     9,    10,     2,     0,
+       2,     0,     6,     7,     9,     5,     5,     4,     1,     5,
+       8,     5,     4,     5,     3,     3,     3,     3,    12,     6,
+       5,     6,    13,     9,     9,     3,     3,     2,     2,     5,
+       2,     0,     1,     0,     1,     0,     4,     2,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     2,     2,     2,     2,     5,     3,     4,     3,     1,
-       2,     1,     1,     2,     2,     4,     3,     4,     3,     4,
-       4,     3,     1,     1,     2,     2,     3,     5,     1,     3,
-       5,     3,     5,     2,     4,     1,     2,     1,     1,     3,
-       2,     1,     2,     1,     1,     2,     4,     3,     1,     1,
+       3,     3,     2,     2,     2,     2,     5,     3,     4,     4,
+       5,     3,     1,     2,     1,     1,     2,     2,     4,     3,
+       4,     3,     4,     4,     3,     4,     3,     1,     1,     2,
+       3,     2,     6,     3,     5,     1,     3,     5,     3,     5,
+       2,     4,     1,     2,     1,     1,     3,     2,     1,     2,
+       1,     1,     2,     4,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1
+       1
 };
 
 /* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
@@ -836,95 +875,107 @@ static const yytype_uint8 yyr2[] =
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       0,     0,     0,   102,     0,     0,     0,   127,   128,   138,
-     139,   140,   141,   142,   146,   143,   147,   144,   148,   145,
-     149,   150,   151,   152,   113,     0,     0,     0,    99,   101,
-       0,     0,     0,     0,     0,    62,    60,    61,     0,     0,
-       0,     0,     0,     0,     2,     5,     6,     0,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,     0,    64,    65,
-      67,    68,    66,    63,    59,     0,    24,    12,   134,     0,
-     133,   131,     0,     0,     0,     0,     0,   103,   100,   114,
-     112,     0,    93,    94,     0,     0,   104,    52,     0,     0,
-       0,   132,     0,     0,     1,     3,     4,     9,     0,     0,
-       0,    49,     0,    10,     0,     0,     0,     0,     0,     0,
-      91,    92,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   115,     0,     0,     0,   144,   145,   155,
+     156,   157,   158,   159,   163,   160,   164,   161,   165,   162,
+     166,   167,   168,   169,   128,     0,     0,     0,   112,   114,
+       0,     0,     0,     0,     0,    73,    71,    72,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   170,     0,     2,
+       5,     6,     0,    16,    17,    18,    25,    19,    20,    21,
+      22,    23,     0,     0,    75,    76,    78,    79,    77,    74,
+      70,     0,    24,    12,   151,     0,   150,   148,     0,     0,
+       0,     0,     0,     0,   116,   113,     0,   129,   127,     0,
+     104,   105,     0,     0,   117,    63,     0,     0,    61,     0,
+       0,   149,     0,     0,     0,     0,     0,     0,     1,     3,
+       4,     9,     0,     0,     0,    57,     0,    10,     0,     0,
+       0,     0,     0,     0,   102,   103,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    50,     0,     0,    11,    13,     0,   135,
-     118,   130,   115,     0,     0,    96,     0,    58,    98,     0,
-       0,   106,     0,     0,    51,     0,    15,    14,     0,     0,
-       0,     0,     0,     0,    37,    39,    52,    47,    38,    79,
-      80,    78,    77,     0,    85,    86,    87,    88,    89,    90,
-     108,    71,    72,    69,    70,    81,    73,    74,    40,    75,
-      76,    82,    83,    84,    52,    48,     0,   129,     0,     0,
-       0,     0,    28,     0,     0,     0,    97,     0,   105,   111,
-       0,     0,     0,    54,     0,     0,     0,     0,     0,   109,
-     110,     0,   107,     0,     0,   137,     0,   119,   116,     0,
-       0,    28,     0,    56,    35,     0,     0,    32,    57,     0,
-       0,     0,    36,     0,    53,    43,     0,    42,     0,   123,
-     120,     0,    54,    54,    95,   136,     0,    27,     8,     0,
-       0,     0,     0,    29,     0,     0,    54,    44,     0,   125,
-       0,     0,   121,     0,     0,   117,     7,     0,     8,    55,
-       0,     0,    30,     0,     0,   126,   124,     0,    54,    54,
-      25,     0,     0,    34,     0,     0,   122,     0,     0,    26,
-      33,    31,     0,    45,    46,     0,    41
+       0,     0,     0,     0,     0,     0,     0,    58,     0,     0,
+      11,    13,     0,   152,   135,   147,   131,     0,     0,   107,
+       0,    69,   111,     0,   130,     0,   119,     0,     0,    62,
+       0,    15,    14,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   124,     0,     0,    44,    46,    63,    55,    45,
+      90,    91,    89,    88,     0,    96,    97,    98,    99,   100,
+     101,   121,    82,    83,    80,    81,    92,    84,    85,    47,
+      86,    87,    93,    94,    95,    63,    56,     0,   146,     0,
+       0,     0,     0,    31,     0,     0,     0,   108,     0,   118,
+     126,     0,     0,     0,    65,     0,     0,    60,     0,   109,
+       0,     0,     0,   122,   123,     0,     0,     0,   125,     0,
+       0,   120,     0,     0,   154,     0,   136,   133,     0,    29,
+      31,     0,    67,    38,     0,     0,    35,    68,     0,     0,
+       0,    43,     0,    64,    50,     0,     0,     0,   110,     0,
+     140,   137,     0,     0,    39,     0,     0,     0,     0,    65,
+      65,   106,   153,     0,    30,     0,    29,     0,     0,     0,
+      32,     0,     0,    65,    51,     0,    49,     0,   142,     0,
+       0,   138,     8,     8,     0,     0,   132,     0,     0,   134,
+      28,     8,     0,    66,     0,     0,    33,     0,     0,    59,
+     143,   141,     0,     7,    42,     0,     8,     0,    65,    65,
+       0,     8,     0,    37,     0,    61,   139,    40,    41,     0,
+       0,     0,    26,     0,    36,    34,     0,    61,    53,    54,
+      27,     0,     0,     0,     0,    48,     0,    52
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    43,   276,   277,    45,    46,   154,    47,    48,   230,
-      49,    50,   237,    51,    52,    53,    54,    55,   155,   243,
-     203,   146,    56,    57,    58,    59,    60,    61,    62,    63,
-      81,    64,    65,   142,    66,   218,   270,    67,    68,    69,
-      70,   139,    71
+      -1,    48,   333,   334,    50,    51,   169,    52,    53,   295,
+     259,    54,    55,   266,    56,   246,    57,    58,    59,    60,
+      61,   175,   170,   272,   224,   160,    62,    63,    64,    65,
+      66,    67,    68,    69,    89,    70,    71,   156,    72,   242,
+     309,    73,    74,    75,    76,   153,    77
 };
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -238
+#define YYPACT_NINF -337
 static const yytype_int16 yypact[] =
 {
-     895,     6,  1127,    34,  1040,  1127,  1127,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  1127,  1127,  1127,  1127,  -238,  -238,
-      54,  1127,  1127,    57,    -2,  -238,  -238,  -238,    56,  1127,
-    1296,    71,    74,    85,   895,  -238,  -238,    56,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,    23,   972,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,    56,  -238,  -238,    45,    10,
-    -238,  -238,    83,  1354,  1071,  1168,    14,   -38,   148,  1598,
-    1598,    -8,  -238,  -238,    84,  1354,    41,  1040,    56,   895,
-    1354,    82,    56,  1040,  -238,  -238,  -238,  -238,  1127,  1127,
-      90,  -238,  1127,  -238,  1127,  1127,  1127,  1127,  1127,  1127,
-    -238,  -238,  1127,  1127,  1127,  1127,  1127,  1127,    94,  1127,
-    1127,  1127,  1127,  1127,  1127,  1127,  1127,  1127,  1127,  1127,
-    1127,  1127,    95,  -238,  1127,  1127,  -238,  -238,  1083,    64,
-      61,  -238,   105,   156,   895,  -238,    55,  1598,  -238,  1127,
-    1127,  -238,   974,   895,  -238,    99,  1598,  -238,   895,   397,
-     895,   117,  1232,    50,  1598,  1598,  1040,  1598,  1598,   -38,
-     -38,   148,   148,  1415,  1598,  1598,  1598,  1598,  1598,  1598,
-    -238,  1795,  1795,  1795,  1795,   -38,  1761,  1761,  1598,  1727,
-    1693,    41,  1814,  1150,  1040,  1598,  1293,  -238,  1476,  1127,
-    1127,   131,    93,    59,    17,   314,  -238,  1127,   -38,  1598,
-      97,    60,   480,  1127,   563,    63,   646,     1,     2,  -238,
-    -238,   128,  -238,   129,  1127,  -238,  1537,  1598,   104,  1296,
-      56,    93,  1296,  -238,  -238,  1127,    56,  -238,  1598,  1296,
-     101,  1231,  -238,   133,  1598,  -238,  1127,  -238,   -14,  -238,
-    -238,     3,  1127,  1127,  1659,  -238,  1127,    82,   895,    56,
-      51,  1354,   895,    82,  1296,   145,  1127,  1598,    98,  -238,
-      56,   -14,  -238,   143,   146,  1598,   895,   163,   895,  -238,
-     895,   729,    82,   115,   159,  -238,  -238,    56,  1127,  1127,
-    -238,   167,   314,  -238,  1296,    56,  -238,   162,   164,  -238,
-    -238,    82,   895,  -238,  -238,   812,  -238
+    1117,     2,  1562,     9,  1280,  1562,  1562,  -337,  -337,  -337,
+    -337,  -337,  -337,  -337,  -337,  -337,  -337,  -337,  -337,  -337,
+    -337,  -337,  -337,  -337,    39,  1562,  1562,  1562,  -337,  -337,
+      32,  1562,  1562,    37,   -25,  -337,  -337,  -337,    60,  1562,
+    1352,    65,    83,  1562,    24,    95,   107,  -337,   122,  1117,
+    -337,  -337,    60,  -337,  -337,  -337,  -337,  -337,  -337,  -337,
+    -337,  -337,    38,  1637,  -337,  -337,  -337,  -337,  -337,  -337,
+    -337,    60,  -337,  -337,    76,     6,  -337,  -337,   117,   133,
+    1955,  1444,  1705,    67,   -23,   210,  1562,  2260,  2260,     1,
+    -337,  -337,   120,  1955,   119,  1201,    60,  1117,  2260,   134,
+    1832,   129,    60,  1280,  1955,   135,  1491,    69,  -337,  -337,
+    -337,  -337,  1562,  1562,   137,  -337,  1562,  -337,  1562,  1562,
+    1562,  1562,  1562,  1562,  -337,  -337,  1562,  1562,  1562,  1562,
+    1562,  1562,   139,  1562,  1562,  1562,  1562,  1562,  1562,  1562,
+    1562,  1562,  1562,  1562,  1562,  1562,   140,  -337,  1562,  1562,
+    -337,  -337,  1503,   108,   101,  -337,   141,  1377,  1117,  -337,
+     105,  2260,  -337,  1562,  2260,  1562,  -337,  1449,  1117,  -337,
+     136,  2260,  -337,  1117,   494,    18,  1550,   144,  1769,    98,
+      90,  1201,  -337,   113,   150,  2260,  2260,  1201,  2260,  2260,
+     -23,   -23,   210,   210,  2016,  2260,  2260,  2260,  2260,  2260,
+    2260,  -337,   303,   303,   303,   303,   -23,  2389,  2389,  2260,
+    2355,  1603,   119,  1224,  1375,  1201,  2260,  1894,  -337,  2077,
+    1562,  1562,   153,   116,   121,    54,   405,  -337,  1562,   -23,
+    2260,   118,   127,   583,  1562,   672,    92,   166,  1117,  -337,
+     128,    -3,    20,  -337,  -337,  1562,    -2,   159,  -337,  1832,
+     162,  -337,   169,  1562,  -337,  2138,  2260,   142,  1832,  -337,
+     116,  1832,  -337,  -337,  1562,    60,  -337,  2260,  1832,   143,
+    1708,  -337,   191,  2260,  -337,  1562,   156,   761,  -337,   -10,
+    -337,  -337,    11,    15,  -337,    60,  1562,  1562,     6,  1562,
+    1562,  2321,  -337,  1562,   129,    45,  -337,    63,  1955,  1117,
+     129,  1832,   201,  1562,  2260,   204,  -337,   157,  -337,    60,
+     -10,  -337,  1117,  1117,    15,  2199,   141,   200,   202,  2260,
+    -337,  1117,    45,  -337,  1117,   850,   129,   173,   218,  -337,
+    -337,  -337,    60,  1117,  -337,   227,  1117,  1562,  1562,  1562,
+     228,  1117,   405,  -337,  1832,  -337,  -337,  -337,  -337,  1833,
+     223,   224,  -337,   231,  -337,   129,    18,  -337,  -337,  -337,
+    -337,  1117,    18,   939,  1117,  -337,  1028,  -337
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -238,  -238,     0,  -103,     5,    11,  -238,  -238,  -238,   -39,
-    -238,  -238,   -97,  -238,  -238,  -238,  -238,  -238,  -126,  -237,
-      44,  -238,  -238,     7,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,   -84,  -238,  -238,  -238,   -74,   -12,  -238,    -3,
-    -238,  -238,  -238
+    -337,  -337,     0,  -227,   -11,    56,    55,  -337,  -337,   -59,
+     -19,  -337,  -337,  -103,  -337,  -337,  -337,  -337,  -337,  -337,
+    -337,  -336,  -180,  -278,    75,  -102,  -337,    64,  -337,  -337,
+    -337,  -337,  -337,  -337,  -237,  -337,   -94,   -45,  -337,  -337,
+     -64,   -21,  -337,    -1,  -337,  -337,  -337
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
@@ -934,39 +985,57 @@ static const yytype_int16 yypgoto[] =
 #define YYTABLE_NINF -1
 static const yytype_uint16 yytable[] =
 {
-      44,    76,   268,   157,   150,   109,   250,   110,   111,    73,
-     251,    75,    77,    78,    72,   273,   274,   118,   140,     7,
-       8,     7,     8,   141,   149,   233,    89,   141,    98,   284,
-     141,    79,    80,    82,    83,    97,   151,    91,    85,    86,
-     221,     7,     8,    74,   103,   136,    90,   269,   248,    95,
-     271,   297,   298,   137,   105,    96,   106,   107,   108,   279,
-     220,   144,    84,   141,   141,   206,    87,   207,   223,   231,
-     240,   232,   241,   153,     7,     8,   158,    88,   160,    92,
-     161,   147,   157,    93,   109,    94,   110,   111,   138,   159,
-     163,    99,   143,   152,   156,   141,   118,   100,   101,   166,
-     162,   123,   180,   102,   194,   164,   165,   199,   200,   167,
-     157,   168,   169,   170,   171,   172,   173,   201,   213,   174,
-     175,   176,   177,   178,   179,   217,   181,   182,   183,   184,
-     185,   186,   187,   188,   189,   190,   191,   192,   193,   228,
-     204,   195,   196,   246,   205,   198,   229,   252,   253,   204,
-     239,   256,   266,   212,   264,   283,   208,   209,   214,   285,
-     216,   105,   288,   106,    95,   289,   202,   290,   294,   295,
-      96,   299,   303,   156,   304,   291,     9,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,   109,   259,   110,   111,   300,   211,   287,     0,     0,
-       0,   156,     0,   118,     0,   249,   226,   227,   123,     0,
-      95,     0,     0,     0,   238,     0,    96,    95,   258,    95,
-     244,    95,     0,    96,   262,    96,   257,    96,     0,   260,
-       0,   254,     0,     0,     0,     0,   263,    40,   260,   272,
-       0,     0,   261,     0,     0,     0,     0,   278,     0,   280,
-       0,     0,     0,   267,     0,     0,     0,     0,   286,   244,
-     244,   282,   281,   275,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   244,     0,   296,     0,     0,     0,     0,
-     292,    95,     0,   302,     0,     0,    95,    96,     0,     0,
-       0,   301,    96,     0,     0,   244,   244,    95,     0,     0,
-       0,     0,   305,    96,     0,     0,     0,     0,     0,     0,
-      95,     0,     0,     0,     0,     0,    96,     1,   234,     2,
-     235,   236,     3,     4,     0,     0,     0,     5,     0,     0,
+      49,   172,   284,    83,   183,   285,   307,   250,   283,   356,
+      78,   317,   318,   165,   154,     7,     8,    97,    81,   155,
+     123,   362,   124,   125,   281,   328,   237,   165,   282,     7,
+       8,   111,   132,     7,     8,   252,     7,     8,   109,   101,
+      92,   117,   150,   112,   279,   166,    95,     3,     4,   314,
+     151,   308,     5,   320,    96,     6,     7,     8,   310,   158,
+     350,   351,   262,     7,     8,   286,    80,   155,    82,    84,
+      85,   323,   168,   102,   240,   173,   155,   163,     7,     8,
+     155,   177,    25,   180,    26,    27,   335,   172,    87,    88,
+      90,    91,   103,   172,   340,    93,    94,   174,   105,   101,
+      28,    29,   179,    98,   106,   110,   113,   104,   244,   348,
+      32,   155,   114,   115,   353,   227,   107,   228,   116,   152,
+      79,   172,   108,   248,    42,   228,   157,    86,    45,   167,
+     184,   260,   119,   261,   120,   121,   122,   269,   278,   270,
+     228,    99,   155,   176,   181,   161,   187,   201,   221,   215,
+     164,   220,   241,   222,   238,   234,   225,   245,   226,   171,
+     249,   257,   123,   109,   124,   125,   225,   178,   233,   258,
+     161,   268,   275,   235,   132,   276,   185,   186,   287,   137,
+     188,   289,   189,   190,   191,   192,   193,   194,   290,   293,
+     195,   196,   197,   198,   199,   200,   301,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     303,   327,   216,   217,   329,   109,   219,   305,   330,   338,
+     280,   339,   109,   119,   109,   120,   344,   229,   345,   230,
+     110,   347,   352,   358,   359,   360,   247,   322,   277,   354,
+     161,   296,   232,   316,   299,   171,   332,     0,   288,     0,
+       0,   171,     0,   123,     0,   124,   125,   294,     0,     0,
+     297,   311,   312,     0,   313,   132,   109,   300,     0,   297,
+     137,     0,     0,     0,   321,     0,     0,   324,     0,   171,
+       0,     0,   110,     0,   255,   256,     0,     0,   331,   110,
+       0,   110,   267,   336,     0,     0,     0,     0,   273,   325,
+     326,   341,     0,     0,     0,     0,     0,     0,     0,    88,
+       0,   346,     0,     0,   109,     0,   119,   291,   120,   121,
+     122,     0,   109,     0,   342,     0,     0,     0,   298,     0,
+       0,   109,     0,   110,     0,   361,     0,     0,     0,   304,
+       0,   364,     0,   355,     0,     0,   123,     0,   124,   125,
+      88,   315,   109,   273,   273,   109,     0,   319,   132,     0,
+       0,   363,     0,   137,   366,     0,     0,   273,     0,     0,
+       0,     0,     0,     0,   143,   144,   145,     0,     0,     0,
+       0,   110,     0,     0,     0,     0,     0,     0,     0,   110,
+       0,     0,     0,     0,     0,     0,     0,     0,   110,     0,
+       0,   349,   273,   273,     0,     0,     0,     0,     1,   263,
+       2,   264,   265,     3,     4,     0,     0,     0,     5,   110,
+       0,     6,   110,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,     0,     0,     0,     0,     0,     0,     0,    25,     0,
+      26,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    28,    29,    30,     0,
+       0,     0,     0,    31,     0,     0,    32,     0,     0,    33,
+      34,    35,    36,    37,    38,    39,    40,     0,     0,    41,
+      42,    43,    44,     0,    45,    46,    47,     1,   236,     2,
+       0,     0,     3,     4,     0,     0,     0,     5,     0,     0,
        6,     0,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
        0,     0,     0,     0,     0,     0,     0,    25,     0,    26,
@@ -974,23 +1043,7 @@ static const yytype_uint16 yytable[] =
        0,     0,     0,     0,     0,    28,    29,    30,     0,     0,
        0,     0,    31,     0,     0,    32,     0,     0,    33,    34,
       35,    36,    37,    38,    39,    40,     0,     0,    41,    42,
-       1,   215,     2,     0,     0,     3,     4,     0,     0,     0,
-       5,     0,     0,     6,     0,     7,     8,     9,    10,    11,
-      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,     0,     0,     0,     0,     0,     0,     0,
-      25,     0,    26,    27,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    28,    29,
-      30,     0,     0,     0,     0,    31,     0,     0,    32,     0,
-       0,    33,    34,    35,    36,    37,    38,    39,    40,     0,
-       0,    41,    42,     1,   242,     2,     0,     0,     3,     4,
-       0,     0,     0,     5,     0,     0,     6,     0,     7,     8,
-       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,    24,     0,     0,     0,     0,
-       0,     0,     0,    25,     0,    26,    27,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    28,    29,    30,     0,     0,     0,     0,    31,     0,
-       0,    32,     0,     0,    33,    34,    35,    36,    37,    38,
-      39,    40,     0,     0,    41,    42,     1,   245,     2,     0,
+      43,    44,     0,    45,    46,    47,     1,   271,     2,     0,
        0,     3,     4,     0,     0,     0,     5,     0,     0,     6,
        0,     7,     8,     9,    10,    11,    12,    13,    14,    15,
       16,    17,    18,    19,    20,    21,    22,    23,    24,     0,
@@ -998,16 +1051,35 @@ static const yytype_uint16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,    28,    29,    30,     0,     0,     0,
        0,    31,     0,     0,    32,     0,     0,    33,    34,    35,
-      36,    37,    38,    39,    40,     0,     0,    41,    42,     1,
-     247,     2,     0,     0,     3,     4,     0,     0,     0,     5,
-       0,     0,     6,     0,     7,     8,     9,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,     0,     0,     0,     0,     0,     0,     0,    25,
-       0,    26,    27,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    28,    29,    30,
-       0,     0,     0,     0,    31,     0,     0,    32,     0,     0,
-      33,    34,    35,    36,    37,    38,    39,    40,     0,     0,
-      41,    42,     1,   293,     2,     0,     0,     3,     4,     0,
+      36,    37,    38,    39,    40,     0,     0,    41,    42,    43,
+      44,     0,    45,    46,    47,     1,   274,     2,     0,     0,
+       3,     4,     0,     0,     0,     5,     0,     0,     6,     0,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,     0,     0,
+       0,     0,     0,     0,     0,    25,     0,    26,    27,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    28,    29,    30,     0,     0,     0,     0,
+      31,     0,     0,    32,     0,     0,    33,    34,    35,    36,
+      37,    38,    39,    40,     0,     0,    41,    42,    43,    44,
+       0,    45,    46,    47,     1,   306,     2,     0,     0,     3,
+       4,     0,     0,     0,     5,     0,     0,     6,     0,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,     0,     0,     0,
+       0,     0,     0,     0,    25,     0,    26,    27,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    28,    29,    30,     0,     0,     0,     0,    31,
+       0,     0,    32,     0,     0,    33,    34,    35,    36,    37,
+      38,    39,    40,     0,     0,    41,    42,    43,    44,     0,
+      45,    46,    47,     1,   343,     2,     0,     0,     3,     4,
+       0,     0,     0,     5,     0,     0,     6,     0,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,     0,     0,     0,     0,
+       0,     0,     0,    25,     0,    26,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    28,    29,    30,     0,     0,     0,     0,    31,     0,
+       0,    32,     0,     0,    33,    34,    35,    36,    37,    38,
+      39,    40,     0,     0,    41,    42,    43,    44,     0,    45,
+      46,    47,     1,   365,     2,     0,     0,     3,     4,     0,
        0,     0,     5,     0,     0,     6,     0,     7,     8,     9,
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,     0,     0,     0,     0,     0,
@@ -1015,151 +1087,206 @@ static const yytype_uint16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
       28,    29,    30,     0,     0,     0,     0,    31,     0,     0,
       32,     0,     0,    33,    34,    35,    36,    37,    38,    39,
-      40,     0,     0,    41,    42,     1,   306,     2,     0,     0,
-       3,     4,     0,     0,     0,     5,     0,     0,     6,     0,
-       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,    24,     0,     0,
-       0,     0,     0,     0,     0,    25,     0,    26,    27,     0,
+      40,     0,     0,    41,    42,    43,    44,     0,    45,    46,
+      47,     1,   367,     2,     0,     0,     3,     4,     0,     0,
+       0,     5,     0,     0,     6,     0,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,     0,     0,     0,     0,     0,     0,
+       0,    25,     0,    26,    27,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    28,
+      29,    30,     0,     0,     0,     0,    31,     0,     0,    32,
+       0,     0,    33,    34,    35,    36,    37,    38,    39,    40,
+       0,     0,    41,    42,    43,    44,     0,    45,    46,    47,
+       1,     0,     2,     0,     0,     3,     4,     0,     0,     0,
+       5,     0,     0,     6,     0,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,     0,     0,     0,     0,     0,     0,     0,
+      25,     0,    26,    27,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    28,    29,
+      30,     0,     0,     0,     0,    31,     0,     0,    32,     0,
+       0,    33,    34,    35,    36,    37,    38,    39,    40,     0,
+       0,    41,    42,    43,    44,     0,    45,    46,    47,     3,
+       4,     0,     0,     0,     5,     0,     0,     6,     0,     0,
+       0,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,     0,   119,     0,   120,
+     121,   122,     0,     0,    25,     0,    26,    27,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    28,    29,    30,     0,     0,     0,     0,
-      31,     0,     0,    32,     0,     0,    33,    34,    35,    36,
-      37,    38,    39,    40,     0,     0,    41,    42,     1,     0,
-       2,     0,     0,     3,     4,     0,     0,     0,     5,     0,
-       0,     6,     0,     7,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,     0,     0,     0,     0,     0,     0,     0,    25,     0,
-      26,    27,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    28,    29,    30,     0,
-       0,     0,     0,    31,     0,     0,    32,     0,     0,    33,
-      34,    35,    36,    37,    38,    39,    40,   104,     0,    41,
-      42,     0,     0,     0,   210,   105,     0,   106,   107,   108,
-       7,     8,     0,     0,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,     0,
-       0,     0,     0,     0,     0,   109,     0,   110,   111,   112,
-     113,   114,   115,   116,   117,     0,     0,   118,   119,   120,
-     121,   122,   123,     0,     0,     0,     0,   124,   125,     0,
-     126,   127,   128,   129,   130,   131,   132,   133,     3,     4,
-       0,     0,   134,     5,   135,    40,     6,     0,     0,     0,
+       0,     0,    28,    29,     0,     0,     0,   123,     0,   124,
+     125,     0,    32,     0,     0,     0,     0,     0,     0,   132,
+       0,     0,    40,     0,   137,     0,    42,     0,     3,     4,
+      45,    46,    47,     5,     0,   143,     6,   145,     0,     0,
        9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,     0,     0,     0,     0,     3,
-       4,   145,     0,    25,     5,    26,    27,     6,     0,     0,
-       0,     3,     4,     0,     0,     0,     5,     0,     0,     6,
+      19,    20,    21,    22,    23,     0,     0,     0,     0,     0,
+       0,     0,     0,    25,     0,    26,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,    28,    29,     0,     0,     0,     0,     0,     0,     0,
-       0,    32,     0,     0,    25,     0,    26,    27,     0,     0,
-       0,    40,     0,     0,     0,    42,    25,   197,    26,    27,
-       0,     0,    28,    29,     0,     3,     4,     0,     0,     0,
-       5,     0,    32,     6,    28,    29,     0,     0,     0,     0,
-       0,     0,     0,     0,    32,     0,    42,     0,     0,     0,
-       0,     0,     0,   105,     0,   106,   107,   108,    42,     0,
-      25,     0,    26,    27,     0,     0,     0,     0,   148,     0,
-       0,   105,     0,   106,   107,   108,     0,     0,    28,    29,
-       0,     0,     0,   109,     0,   110,   111,     0,    32,     0,
-       0,     0,     0,     0,     0,   118,     0,     0,     0,     0,
-     123,   109,    42,   110,   111,   112,   113,   114,   115,   116,
-     117,   129,     0,   118,   119,   120,   121,   122,   123,     0,
-       0,     0,     0,   124,   125,     0,     0,   127,   128,   129,
-     130,   131,   219,     0,     0,   105,     0,   106,   107,   108,
-     135,     9,    10,    11,    12,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   109,     0,   110,   111,   112,
-     113,   114,   115,   116,   117,     0,     0,   118,   119,   120,
-     121,   122,   123,     0,     0,   265,     0,   124,   125,     0,
-       0,   127,   128,   129,   130,   131,   105,     0,   106,   107,
-     108,     0,    40,     0,   135,     0,     9,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,     0,     0,     0,     0,     0,   109,     0,   110,   111,
-     112,   113,   114,   115,   116,   117,     0,     0,   118,   119,
-     120,   121,   122,   123,     0,     0,     0,     0,   124,   125,
-       0,     0,   127,   128,   129,   130,   131,   105,     0,   106,
-     107,   108,     7,     8,     0,   135,   224,    40,     0,     0,
+       0,    32,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,    40,     0,     0,     0,    42,     0,     0,     0,    45,
+       0,    47,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,   223,   119,     0,
+     120,   121,   122,     0,     0,     0,     0,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,     0,     0,     0,     0,     0,     0,   123,     0,
+     124,   125,     0,     0,     0,     0,     0,     0,     0,     0,
+     132,     0,     0,   100,     0,   137,     0,     0,     0,     0,
+       0,     0,     0,    47,     0,     0,   143,     0,     0,     0,
+       0,     0,     3,     4,   159,     0,     0,     5,   100,   231,
+       6,     0,     0,     0,     0,     0,     0,     0,    47,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,     0,     0,     0,    25,     0,    26,
+      27,     0,     0,     0,     0,     0,     0,     0,     0,     3,
+       4,   182,     0,     0,     5,    28,    29,     6,     0,     0,
+       0,     3,     4,     0,     0,    32,     5,     0,     0,     6,
+       0,     0,     0,     0,     0,    79,     0,     0,     0,    42,
+     100,     0,     0,    45,    25,     0,    26,    27,     0,     0,
+      47,     0,     0,     0,     0,     0,    25,   218,    26,    27,
+       0,     0,    28,    29,     0,     0,     0,     0,     3,     4,
+     239,     0,    32,     5,    28,    29,     6,     0,     0,     0,
+       3,     4,    79,     0,    32,     5,    42,     0,     6,     0,
+      45,     0,     0,     0,    79,     0,     0,     0,    42,     0,
+       0,     0,    45,    25,     0,    26,    27,     0,     0,     0,
+       0,     0,     0,     0,     0,    25,     0,    26,    27,     0,
+       0,    28,    29,     0,     0,     0,   119,     0,   120,   121,
+     122,    32,     0,    28,    29,     0,     0,     0,     0,     0,
+       0,    79,     0,    32,     0,    42,     0,     0,     0,    45,
+       0,     0,   118,    79,     0,     0,   123,    42,   124,   125,
+     119,    45,   120,   121,   122,     7,     8,     0,   132,   133,
+     134,   135,   136,   137,     0,     0,     0,     0,   138,   139,
+       0,     0,   141,     0,   143,   144,   145,     0,     0,     0,
+     123,     0,   124,   125,   126,   127,   128,   129,   130,   131,
+       0,     0,   132,   133,   134,   135,   136,   137,     0,     0,
+       0,     0,   138,   139,     0,   140,   141,   142,   143,   144,
+     145,   146,   147,     0,     0,   162,     0,   148,   119,   149,
+     120,   121,   122,     0,     0,     0,     0,     0,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,     0,     0,     0,     0,     0,   123,     0,
+     124,   125,   126,   127,   128,   129,   130,   131,     0,     0,
+     132,   133,   134,   135,   136,   137,     0,     0,     0,     0,
+     138,   139,   302,     0,   141,   142,   143,   144,   145,   243,
+       0,     0,   119,     0,   120,   121,   122,   149,     0,   100,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    47,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   123,     0,   124,   125,   126,   127,   128,   129,
+     130,   131,     0,     0,   132,   133,   134,   135,   136,   137,
+       0,     0,     0,     0,   138,   139,     0,     0,   141,   142,
+     143,   144,   145,   357,     0,     0,   119,     0,   120,   121,
+     122,   149,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   123,     0,   124,   125,
+     126,   127,   128,   129,   130,   131,     0,     0,   132,   133,
+     134,   135,   136,   137,     0,     0,     0,     0,   138,   139,
+       0,     0,   141,   142,   143,   144,   145,   119,     0,   120,
+     121,   122,     0,   100,     0,   149,     0,     0,     0,     0,
+       0,     0,     0,    47,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   123,     0,   124,
+     125,   126,   127,   128,   129,   130,   131,     0,     0,   132,
+     133,   134,   135,   136,   137,     0,     0,     0,     0,   138,
+     139,     0,     0,   141,   142,   143,   144,   145,   119,     0,
+     120,   121,   122,     7,     8,     0,   149,   253,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   109,     0,   110,
-     111,   112,   113,   114,   115,   116,   117,     0,     0,   118,
-     119,   120,   121,   122,   123,     0,     0,     0,     0,   124,
-     125,     0,     0,   127,   128,   129,   130,   131,   105,     0,
-     106,   107,   108,     0,     0,     0,   135,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   123,     0,
+     124,   125,   126,   127,   128,   129,   130,   131,     0,     0,
+     132,   133,   134,   135,   136,   137,     0,     0,     0,     0,
+     138,   139,     0,     0,   141,   142,   143,   144,   145,   119,
+       0,   120,   121,   122,     0,     0,     0,   149,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   109,   222,
-     110,   111,   112,   113,   114,   115,   116,   117,     0,     0,
-     118,   119,   120,   121,   122,   123,     0,     0,     0,     0,
-     124,   125,     0,     0,   127,   128,   129,   130,   131,   105,
-       0,   106,   107,   108,     0,     0,     0,   135,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   123,
+     251,   124,   125,   126,   127,   128,   129,   130,   131,     0,
+       0,   132,   133,   134,   135,   136,   137,     0,     0,     0,
+       0,   138,   139,     0,     0,   141,   142,   143,   144,   145,
+     119,     0,   120,   121,   122,     0,     0,     0,   149,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   109,
-     225,   110,   111,   112,   113,   114,   115,   116,   117,     0,
-       0,   118,   119,   120,   121,   122,   123,     0,     0,     0,
-       0,   124,   125,     0,     0,   127,   128,   129,   130,   131,
-     105,     0,   106,   107,   108,     0,     0,     0,   135,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     123,   254,   124,   125,   126,   127,   128,   129,   130,   131,
+       0,     0,   132,   133,   134,   135,   136,   137,     0,     0,
+       0,     0,   138,   139,     0,     0,   141,   142,   143,   144,
+     145,   119,     0,   120,   121,   122,     0,     0,     0,   149,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     109,   255,   110,   111,   112,   113,   114,   115,   116,   117,
-       0,     0,   118,   119,   120,   121,   122,   123,     0,     0,
-       0,     0,   124,   125,     0,     0,   127,   128,   129,   130,
-     131,   105,     0,   106,   107,   108,     0,     0,     0,   135,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   123,   292,   124,   125,   126,   127,   128,   129,   130,
+     131,     0,     0,   132,   133,   134,   135,   136,   137,     0,
+       0,     0,     0,   138,   139,     0,     0,   141,   142,   143,
+     144,   145,   119,     0,   120,   121,   122,     0,   337,     0,
+     149,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   109,     0,   110,   111,   112,   113,   114,   115,   116,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,     0,
-       0,     0,     0,   124,   125,     0,     0,   127,   128,   129,
-     130,   131,   105,     0,   106,   107,   108,     0,     0,     0,
-     135,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   123,     0,   124,   125,   126,   127,   128,   129,
+     130,   131,     0,     0,   132,   133,   134,   135,   136,   137,
+       0,     0,     0,     0,   138,   139,     0,     0,   141,   142,
+     143,   144,   145,   119,     0,   120,   121,   122,     0,     0,
+       0,   149,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   109,     0,   110,   111,   105,     0,   106,   107,
-     108,     0,     0,     0,   118,   119,   120,   121,   122,   123,
-       0,     0,     0,     0,   124,   125,     0,     0,   127,   128,
-     129,   130,   131,     0,     0,     0,   109,     0,   110,   111,
-     105,   135,   106,   107,   108,     0,     0,     0,   118,   119,
-     120,   121,   122,   123,     0,     0,     0,     0,   124,   125,
-       0,     0,   127,     0,   129,   130,   131,     0,     0,     0,
-     109,     0,   110,   111,   105,     0,   106,   107,   108,     0,
-       0,     0,   118,   119,   120,   121,   122,   123,     0,     0,
-       0,     0,   124,   125,     0,     0,     0,     0,   129,   130,
-     131,     0,     0,     0,   109,     0,   110,   111,   105,     0,
-     106,   107,   108,     0,     0,     0,   118,   119,   120,   121,
-     122,   123,     0,     0,     0,     0,     0,   105,     0,   106,
-     107,   108,   129,   130,   131,     0,     0,     0,   109,     0,
-     110,   111,     0,     0,     0,     0,     0,     0,     0,     0,
-     118,     0,     0,     0,     0,   123,     0,   109,     0,   110,
-     111,     0,     0,     0,     0,     0,   129,   130,   131,   118,
-       0,     0,     0,     0,   123,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   129,     0,   131
+       0,     0,     0,   123,     0,   124,   125,   126,   127,   128,
+     129,   130,   131,     0,     0,   132,   133,   134,   135,   136,
+     137,     0,     0,     0,     0,   138,   139,     0,     0,   141,
+     142,   143,   144,   145,   119,     0,   120,   121,   122,     0,
+       0,     0,   149,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   123,     0,   124,   125,   119,     0,
+     120,   121,   122,     0,     0,     0,   132,   133,   134,   135,
+     136,   137,     0,     0,     0,     0,   138,   139,     0,     0,
+     141,   142,   143,   144,   145,     0,     0,     0,   123,     0,
+     124,   125,   119,   149,   120,   121,   122,     0,     0,     0,
+     132,   133,   134,   135,   136,   137,     0,     0,     0,     0,
+     138,   139,     0,     0,     0,     0,   143,   144,   145,     0,
+       0,     0,   123,     0,   124,   125,     0,     0,     0,     0,
+       0,     0,     0,     0,   132,   133,   134,   135,   136,   137,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     143,   144,   145
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,     4,    16,    87,    12,    43,     4,    45,    46,     2,
-       8,     4,     5,     6,     8,   252,   253,    55,     8,    18,
-      19,    18,    19,    13,    10,     8,    38,    13,     5,   266,
-      13,    24,    25,    26,    27,    47,    44,    40,    31,    32,
-     166,    18,    19,     9,    56,    57,    39,    61,    47,    44,
-      47,   288,   289,    65,    13,    44,    15,    16,    17,     8,
-      10,    73,     8,    13,    13,    10,     9,    12,   194,    10,
-      10,    12,    12,    85,    18,    19,    88,    79,    90,     8,
-      92,    74,   166,     9,    43,     0,    45,    46,    43,    89,
-      93,    68,     9,     9,    87,    13,    55,    74,    75,     9,
-      93,    60,     8,    80,     9,    98,    99,    43,    47,   102,
-     194,   104,   105,   106,   107,   108,   109,    12,    19,   112,
-     113,   114,   115,   116,   117,     8,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,   131,     8,
-     143,   134,   135,    80,   144,   138,    53,    19,    19,   152,
-      53,    47,    19,   153,    53,    10,   149,   150,   158,    61,
-     160,    13,    19,    15,   159,    19,    10,     4,    53,    10,
-     159,     4,    10,   166,    10,   278,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    43,   231,    45,    46,   292,   152,   271,    -1,    -1,
-      -1,   194,    -1,    55,    -1,   217,   199,   200,    60,    -1,
-     205,    -1,    -1,    -1,   207,    -1,   205,   212,   230,   214,
-     213,   216,    -1,   212,   236,   214,   229,   216,    -1,   232,
-      -1,   224,    -1,    -1,    -1,    -1,   239,    81,   241,   251,
-      -1,    -1,   235,    -1,    -1,    -1,    -1,   259,    -1,   261,
-      -1,    -1,    -1,   246,    -1,    -1,    -1,    -1,   270,   252,
-     253,   264,   262,   256,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   266,    -1,   287,    -1,    -1,    -1,    -1,
-     280,   276,    -1,   295,    -1,    -1,   281,   276,    -1,    -1,
-      -1,   294,   281,    -1,    -1,   288,   289,   292,    -1,    -1,
-      -1,    -1,   302,   292,    -1,    -1,    -1,    -1,    -1,    -1,
-     305,    -1,    -1,    -1,    -1,    -1,   305,     3,     4,     5,
-       6,     7,     8,     9,    -1,    -1,    -1,    13,    -1,    -1,
+       0,    95,     4,     4,   106,     7,    16,   187,   245,   345,
+       8,   289,   290,    12,     8,    18,    19,    38,     9,    13,
+      43,   357,    45,    46,     4,   303,     8,    12,     8,    18,
+      19,    52,    55,    18,    19,   215,    18,    19,    49,    40,
+       8,    62,    63,     5,    47,    44,     9,     8,     9,   286,
+      71,    61,    13,     8,    79,    16,    18,    19,    47,    80,
+     338,   339,     8,    18,    19,    67,     2,    13,     4,     5,
+       6,     8,    93,     8,   176,    96,    13,    10,    18,    19,
+      13,   102,    43,   104,    45,    46,   313,   181,    24,    25,
+      26,    27,     9,   187,   321,    31,    32,    97,    74,   100,
+      61,    62,   103,    39,     9,    49,    68,    43,    10,   336,
+      71,    13,    74,    75,   341,    10,     9,    12,    80,    43,
+      81,   215,     0,    10,    85,    12,     9,    88,    89,     9,
+      61,    10,    13,    12,    15,    16,    17,    10,    10,    12,
+      12,     8,    13,     9,     9,    81,     9,     8,    47,     9,
+      86,    43,     8,    12,   175,    19,   157,    67,   158,    95,
+      10,     8,    43,   174,    45,    46,   167,   103,   168,    53,
+     106,    53,    80,   173,    55,     9,   112,   113,    19,    60,
+     116,    19,   118,   119,   120,   121,   122,   123,    19,    47,
+     126,   127,   128,   129,   130,   131,    53,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+      19,    10,   148,   149,    10,   226,   152,    61,    61,    19,
+     241,    19,   233,    13,   235,    15,    53,   163,    10,   165,
+     174,     4,     4,    10,    10,     4,   181,   296,   238,   342,
+     176,   260,   167,   288,   265,   181,   310,    -1,   249,    -1,
+      -1,   187,    -1,    43,    -1,    45,    46,   258,    -1,    -1,
+     261,   282,   283,    -1,   285,    55,   277,   268,    -1,   270,
+      60,    -1,    -1,    -1,   295,    -1,    -1,   298,    -1,   215,
+      -1,    -1,   226,    -1,   220,   221,    -1,    -1,   309,   233,
+      -1,   235,   228,   314,    -1,    -1,    -1,    -1,   234,   299,
+     301,   322,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   245,
+      -1,   332,    -1,    -1,   325,    -1,    13,   253,    15,    16,
+      17,    -1,   333,    -1,   324,    -1,    -1,    -1,   264,    -1,
+      -1,   342,    -1,   277,    -1,   356,    -1,    -1,    -1,   275,
+      -1,   362,    -1,   344,    -1,    -1,    43,    -1,    45,    46,
+     286,   287,   363,   289,   290,   366,    -1,   293,    55,    -1,
+      -1,   361,    -1,    60,   364,    -1,    -1,   303,    -1,    -1,
+      -1,    -1,    -1,    -1,    71,    72,    73,    -1,    -1,    -1,
+      -1,   325,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   333,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   342,    -1,
+      -1,   337,   338,   339,    -1,    -1,    -1,    -1,     3,     4,
+       5,     6,     7,     8,     9,    -1,    -1,    -1,    13,   363,
+      -1,    16,   366,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,
+      45,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    61,    62,    63,    -1,
+      -1,    -1,    -1,    68,    -1,    -1,    71,    -1,    -1,    74,
+      75,    76,    77,    78,    79,    80,    81,    -1,    -1,    84,
+      85,    86,    87,    -1,    89,    90,    91,     3,     4,     5,
+      -1,    -1,     8,     9,    -1,    -1,    -1,    13,    -1,    -1,
       16,    -1,    18,    19,    20,    21,    22,    23,    24,    25,
       26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,    45,
@@ -1167,23 +1294,7 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    61,    62,    63,    -1,    -1,
       -1,    -1,    68,    -1,    -1,    71,    -1,    -1,    74,    75,
       76,    77,    78,    79,    80,    81,    -1,    -1,    84,    85,
-       3,     4,     5,    -1,    -1,     8,     9,    -1,    -1,    -1,
-      13,    -1,    -1,    16,    -1,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      43,    -1,    45,    46,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    61,    62,
-      63,    -1,    -1,    -1,    -1,    68,    -1,    -1,    71,    -1,
-      -1,    74,    75,    76,    77,    78,    79,    80,    81,    -1,
-      -1,    84,    85,     3,     4,     5,    -1,    -1,     8,     9,
-      -1,    -1,    -1,    13,    -1,    -1,    16,    -1,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    43,    -1,    45,    46,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    61,    62,    63,    -1,    -1,    -1,    -1,    68,    -1,
-      -1,    71,    -1,    -1,    74,    75,    76,    77,    78,    79,
-      80,    81,    -1,    -1,    84,    85,     3,     4,     5,    -1,
+      86,    87,    -1,    89,    90,    91,     3,     4,     5,    -1,
       -1,     8,     9,    -1,    -1,    -1,    13,    -1,    -1,    16,
       -1,    18,    19,    20,    21,    22,    23,    24,    25,    26,
       27,    28,    29,    30,    31,    32,    33,    34,    35,    -1,
@@ -1191,16 +1302,35 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    61,    62,    63,    -1,    -1,    -1,
       -1,    68,    -1,    -1,    71,    -1,    -1,    74,    75,    76,
-      77,    78,    79,    80,    81,    -1,    -1,    84,    85,     3,
-       4,     5,    -1,    -1,     8,     9,    -1,    -1,    -1,    13,
-      -1,    -1,    16,    -1,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    43,
-      -1,    45,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    61,    62,    63,
-      -1,    -1,    -1,    -1,    68,    -1,    -1,    71,    -1,    -1,
-      74,    75,    76,    77,    78,    79,    80,    81,    -1,    -1,
-      84,    85,     3,     4,     5,    -1,    -1,     8,     9,    -1,
+      77,    78,    79,    80,    81,    -1,    -1,    84,    85,    86,
+      87,    -1,    89,    90,    91,     3,     4,     5,    -1,    -1,
+       8,     9,    -1,    -1,    -1,    13,    -1,    -1,    16,    -1,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    61,    62,    63,    -1,    -1,    -1,    -1,
+      68,    -1,    -1,    71,    -1,    -1,    74,    75,    76,    77,
+      78,    79,    80,    81,    -1,    -1,    84,    85,    86,    87,
+      -1,    89,    90,    91,     3,     4,     5,    -1,    -1,     8,
+       9,    -1,    -1,    -1,    13,    -1,    -1,    16,    -1,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    43,    -1,    45,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    61,    62,    63,    -1,    -1,    -1,    -1,    68,
+      -1,    -1,    71,    -1,    -1,    74,    75,    76,    77,    78,
+      79,    80,    81,    -1,    -1,    84,    85,    86,    87,    -1,
+      89,    90,    91,     3,     4,     5,    -1,    -1,     8,     9,
+      -1,    -1,    -1,    13,    -1,    -1,    16,    -1,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    43,    -1,    45,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    61,    62,    63,    -1,    -1,    -1,    -1,    68,    -1,
+      -1,    71,    -1,    -1,    74,    75,    76,    77,    78,    79,
+      80,    81,    -1,    -1,    84,    85,    86,    87,    -1,    89,
+      90,    91,     3,     4,     5,    -1,    -1,     8,     9,    -1,
       -1,    -1,    13,    -1,    -1,    16,    -1,    18,    19,    20,
       21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
       31,    32,    33,    34,    35,    -1,    -1,    -1,    -1,    -1,
@@ -1208,71 +1338,104 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       61,    62,    63,    -1,    -1,    -1,    -1,    68,    -1,    -1,
       71,    -1,    -1,    74,    75,    76,    77,    78,    79,    80,
-      81,    -1,    -1,    84,    85,     3,     4,     5,    -1,    -1,
-       8,     9,    -1,    -1,    -1,    13,    -1,    -1,    16,    -1,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    46,    -1,
+      81,    -1,    -1,    84,    85,    86,    87,    -1,    89,    90,
+      91,     3,     4,     5,    -1,    -1,     8,     9,    -1,    -1,
+      -1,    13,    -1,    -1,    16,    -1,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    43,    -1,    45,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    61,
+      62,    63,    -1,    -1,    -1,    -1,    68,    -1,    -1,    71,
+      -1,    -1,    74,    75,    76,    77,    78,    79,    80,    81,
+      -1,    -1,    84,    85,    86,    87,    -1,    89,    90,    91,
+       3,    -1,     5,    -1,    -1,     8,     9,    -1,    -1,    -1,
+      13,    -1,    -1,    16,    -1,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      43,    -1,    45,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    61,    62,
+      63,    -1,    -1,    -1,    -1,    68,    -1,    -1,    71,    -1,
+      -1,    74,    75,    76,    77,    78,    79,    80,    81,    -1,
+      -1,    84,    85,    86,    87,    -1,    89,    90,    91,     8,
+       9,    -1,    -1,    -1,    13,    -1,    -1,    16,    -1,    -1,
+      -1,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    -1,    13,    -1,    15,
+      16,    17,    -1,    -1,    43,    -1,    45,    46,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    61,    62,    63,    -1,    -1,    -1,    -1,
-      68,    -1,    -1,    71,    -1,    -1,    74,    75,    76,    77,
-      78,    79,    80,    81,    -1,    -1,    84,    85,     3,    -1,
-       5,    -1,    -1,     8,     9,    -1,    -1,    -1,    13,    -1,
-      -1,    16,    -1,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,
-      45,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    61,    62,    63,    -1,
-      -1,    -1,    -1,    68,    -1,    -1,    71,    -1,    -1,    74,
-      75,    76,    77,    78,    79,    80,    81,     5,    -1,    84,
-      85,    -1,    -1,    -1,    10,    13,    -1,    15,    16,    17,
-      18,    19,    -1,    -1,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    -1,
-      -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    46,    47,
-      48,    49,    50,    51,    52,    -1,    -1,    55,    56,    57,
-      58,    59,    60,    -1,    -1,    -1,    -1,    65,    66,    -1,
-      68,    69,    70,    71,    72,    73,    74,    75,     8,     9,
-      -1,    -1,    80,    13,    82,    81,    16,    -1,    -1,    -1,
+      -1,    -1,    61,    62,    -1,    -1,    -1,    43,    -1,    45,
+      46,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    55,
+      -1,    -1,    81,    -1,    60,    -1,    85,    -1,     8,     9,
+      89,    90,    91,    13,    -1,    71,    16,    73,    -1,    -1,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    -1,    -1,    -1,    -1,     8,
-       9,    10,    -1,    43,    13,    45,    46,    16,    -1,    -1,
-      -1,     8,     9,    -1,    -1,    -1,    13,    -1,    -1,    16,
+      30,    31,    32,    33,    34,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    43,    -1,    45,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    61,    62,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    71,    -1,    -1,    43,    -1,    45,    46,    -1,    -1,
-      -1,    81,    -1,    -1,    -1,    85,    43,    44,    45,    46,
-      -1,    -1,    61,    62,    -1,     8,     9,    -1,    -1,    -1,
-      13,    -1,    71,    16,    61,    62,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    71,    -1,    85,    -1,    -1,    -1,
-      -1,    -1,    -1,    13,    -1,    15,    16,    17,    85,    -1,
-      43,    -1,    45,    46,    -1,    -1,    -1,    -1,    10,    -1,
-      -1,    13,    -1,    15,    16,    17,    -1,    -1,    61,    62,
-      -1,    -1,    -1,    43,    -1,    45,    46,    -1,    71,    -1,
-      -1,    -1,    -1,    -1,    -1,    55,    -1,    -1,    -1,    -1,
-      60,    43,    85,    45,    46,    47,    48,    49,    50,    51,
-      52,    71,    -1,    55,    56,    57,    58,    59,    60,    -1,
-      -1,    -1,    -1,    65,    66,    -1,    -1,    69,    70,    71,
-      72,    73,    10,    -1,    -1,    13,    -1,    15,    16,    17,
-      82,    20,    21,    22,    23,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    46,    47,
-      48,    49,    50,    51,    52,    -1,    -1,    55,    56,    57,
-      58,    59,    60,    -1,    -1,    64,    -1,    65,    66,    -1,
-      -1,    69,    70,    71,    72,    73,    13,    -1,    15,    16,
-      17,    -1,    81,    -1,    82,    -1,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    46,
+      -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       8,    81,    -1,    -1,    -1,    85,    -1,    -1,    -1,    89,
+      -1,    91,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    10,    13,    -1,
+      15,    16,    17,    -1,    -1,    -1,    -1,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,
+      45,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      55,    -1,    -1,    81,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    91,    -1,    -1,    71,    -1,    -1,    -1,
+      -1,    -1,     8,     9,    10,    -1,    -1,    13,    81,    10,
+      16,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    91,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    -1,    -1,    -1,    43,    -1,    45,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     8,
+       9,    10,    -1,    -1,    13,    61,    62,    16,    -1,    -1,
+      -1,     8,     9,    -1,    -1,    71,    13,    -1,    -1,    16,
+      -1,    -1,    -1,    -1,    -1,    81,    -1,    -1,    -1,    85,
+      81,    -1,    -1,    89,    43,    -1,    45,    46,    -1,    -1,
+      91,    -1,    -1,    -1,    -1,    -1,    43,    44,    45,    46,
+      -1,    -1,    61,    62,    -1,    -1,    -1,    -1,     8,     9,
+      10,    -1,    71,    13,    61,    62,    16,    -1,    -1,    -1,
+       8,     9,    81,    -1,    71,    13,    85,    -1,    16,    -1,
+      89,    -1,    -1,    -1,    81,    -1,    -1,    -1,    85,    -1,
+      -1,    -1,    89,    43,    -1,    45,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    46,    -1,
+      -1,    61,    62,    -1,    -1,    -1,    13,    -1,    15,    16,
+      17,    71,    -1,    61,    62,    -1,    -1,    -1,    -1,    -1,
+      -1,    81,    -1,    71,    -1,    85,    -1,    -1,    -1,    89,
+      -1,    -1,     5,    81,    -1,    -1,    43,    85,    45,    46,
+      13,    89,    15,    16,    17,    18,    19,    -1,    55,    56,
+      57,    58,    59,    60,    -1,    -1,    -1,    -1,    65,    66,
+      -1,    -1,    69,    -1,    71,    72,    73,    -1,    -1,    -1,
+      43,    -1,    45,    46,    47,    48,    49,    50,    51,    52,
+      -1,    -1,    55,    56,    57,    58,    59,    60,    -1,    -1,
+      -1,    -1,    65,    66,    -1,    68,    69,    70,    71,    72,
+      73,    74,    75,    -1,    -1,    10,    -1,    80,    13,    82,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    -1,    -1,    -1,    -1,    -1,    43,    -1,
+      45,    46,    47,    48,    49,    50,    51,    52,    -1,    -1,
+      55,    56,    57,    58,    59,    60,    -1,    -1,    -1,    -1,
+      65,    66,    64,    -1,    69,    70,    71,    72,    73,    10,
+      -1,    -1,    13,    -1,    15,    16,    17,    82,    -1,    81,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    91,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    43,    -1,    45,    46,    47,    48,    49,    50,
+      51,    52,    -1,    -1,    55,    56,    57,    58,    59,    60,
+      -1,    -1,    -1,    -1,    65,    66,    -1,    -1,    69,    70,
+      71,    72,    73,    10,    -1,    -1,    13,    -1,    15,    16,
+      17,    82,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    46,
       47,    48,    49,    50,    51,    52,    -1,    -1,    55,    56,
       57,    58,    59,    60,    -1,    -1,    -1,    -1,    65,    66,
       -1,    -1,    69,    70,    71,    72,    73,    13,    -1,    15,
-      16,    17,    18,    19,    -1,    82,    83,    81,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      16,    17,    -1,    81,    -1,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    91,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,    45,
       46,    47,    48,    49,    50,    51,    52,    -1,    -1,    55,
       56,    57,    58,    59,    60,    -1,    -1,    -1,    -1,    65,
       66,    -1,    -1,    69,    70,    71,    72,    73,    13,    -1,
-      15,    16,    17,    -1,    -1,    -1,    82,    -1,    -1,    -1,
+      15,    16,    17,    18,    19,    -1,    82,    83,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    43,    44,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,
       45,    46,    47,    48,    49,    50,    51,    52,    -1,    -1,
       55,    56,    57,    58,    59,    60,    -1,    -1,    -1,    -1,
       65,    66,    -1,    -1,    69,    70,    71,    72,    73,    13,
@@ -1291,31 +1454,35 @@ static const yytype_int16 yycheck[] =
       73,    13,    -1,    15,    16,    17,    -1,    -1,    -1,    82,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    43,    -1,    45,    46,    47,    48,    49,    50,    51,
+      -1,    43,    44,    45,    46,    47,    48,    49,    50,    51,
       52,    -1,    -1,    55,    56,    57,    58,    59,    60,    -1,
       -1,    -1,    -1,    65,    66,    -1,    -1,    69,    70,    71,
-      72,    73,    13,    -1,    15,    16,    17,    -1,    -1,    -1,
+      72,    73,    13,    -1,    15,    16,    17,    -1,    19,    -1,
       82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    43,    -1,    45,    46,    13,    -1,    15,    16,
-      17,    -1,    -1,    -1,    55,    56,    57,    58,    59,    60,
+      -1,    -1,    43,    -1,    45,    46,    47,    48,    49,    50,
+      51,    52,    -1,    -1,    55,    56,    57,    58,    59,    60,
       -1,    -1,    -1,    -1,    65,    66,    -1,    -1,    69,    70,
-      71,    72,    73,    -1,    -1,    -1,    43,    -1,    45,    46,
-      13,    82,    15,    16,    17,    -1,    -1,    -1,    55,    56,
-      57,    58,    59,    60,    -1,    -1,    -1,    -1,    65,    66,
-      -1,    -1,    69,    -1,    71,    72,    73,    -1,    -1,    -1,
-      43,    -1,    45,    46,    13,    -1,    15,    16,    17,    -1,
-      -1,    -1,    55,    56,    57,    58,    59,    60,    -1,    -1,
-      -1,    -1,    65,    66,    -1,    -1,    -1,    -1,    71,    72,
-      73,    -1,    -1,    -1,    43,    -1,    45,    46,    13,    -1,
+      71,    72,    73,    13,    -1,    15,    16,    17,    -1,    -1,
+      -1,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    43,    -1,    45,    46,    47,    48,    49,
+      50,    51,    52,    -1,    -1,    55,    56,    57,    58,    59,
+      60,    -1,    -1,    -1,    -1,    65,    66,    -1,    -1,    69,
+      70,    71,    72,    73,    13,    -1,    15,    16,    17,    -1,
+      -1,    -1,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    43,    -1,    45,    46,    13,    -1,
       15,    16,    17,    -1,    -1,    -1,    55,    56,    57,    58,
-      59,    60,    -1,    -1,    -1,    -1,    -1,    13,    -1,    15,
-      16,    17,    71,    72,    73,    -1,    -1,    -1,    43,    -1,
-      45,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      55,    -1,    -1,    -1,    -1,    60,    -1,    43,    -1,    45,
-      46,    -1,    -1,    -1,    -1,    -1,    71,    72,    73,    55,
-      -1,    -1,    -1,    -1,    60,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    71,    -1,    73
+      59,    60,    -1,    -1,    -1,    -1,    65,    66,    -1,    -1,
+      69,    70,    71,    72,    73,    -1,    -1,    -1,    43,    -1,
+      45,    46,    13,    82,    15,    16,    17,    -1,    -1,    -1,
+      55,    56,    57,    58,    59,    60,    -1,    -1,    -1,    -1,
+      65,    66,    -1,    -1,    -1,    -1,    71,    72,    73,    -1,
+      -1,    -1,    43,    -1,    45,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    55,    56,    57,    58,    59,    60,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      71,    72,    73
 };
 
 /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
@@ -1326,33 +1493,39 @@ static const yytype_uint8 yystos[] =
       21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
       31,    32,    33,    34,    35,    43,    45,    46,    61,    62,
       63,    68,    71,    74,    75,    76,    77,    78,    79,    80,
-      81,    84,    85,    87,    88,    90,    91,    93,    94,    96,
-      97,    99,   100,   101,   102,   103,   108,   109,   110,   111,
-     112,   113,   114,   115,   117,   118,   120,   123,   124,   125,
-     126,   128,     8,   109,     9,   109,   125,   109,   109,   109,
-     109,   116,   109,   109,     8,   109,   109,     9,    79,   123,
-     109,   125,     8,     9,     0,    90,    91,   123,     5,    68,
-      74,    75,    80,   123,     5,    13,    15,    16,    17,    43,
-      45,    46,    47,    48,    49,    50,    51,    52,    55,    56,
-      57,    58,    59,    60,    65,    66,    68,    69,    70,    71,
-      72,    73,    74,    75,    80,    82,   123,   123,    43,   127,
-       8,    13,   119,     9,   123,    10,   107,   109,    10,    10,
-      12,    44,     9,   123,    92,   104,   109,   118,   123,    88,
-     123,   123,   109,   125,   109,   109,     9,   109,   109,   109,
-     109,   109,   109,   109,   109,   109,   109,   109,   109,   109,
-       8,   109,   109,   109,   109,   109,   109,   109,   109,   109,
-     109,   109,   109,   109,     9,   109,   109,    44,   109,    43,
-      47,    12,    10,   106,   125,    88,    10,    12,   109,   109,
-      10,   106,    88,    19,    88,     4,    88,     8,   121,    10,
-      10,   104,    44,   104,    83,    44,   109,   109,     8,    53,
-      95,    10,    12,     8,     4,     6,     7,    98,   109,    53,
-      10,    12,     4,   105,   109,     4,    80,     4,    47,   123,
-       4,     8,    19,    19,   109,    44,    47,   125,   123,    95,
-     125,   109,   123,   125,    53,    64,    19,   109,    16,    61,
-     122,    47,   123,   105,   105,   109,    88,    89,   123,     8,
-     123,    88,   125,    10,   105,    61,   123,   122,    19,    19,
-       4,    89,    88,     4,    53,    10,   123,   105,   105,     4,
-      98,   125,   123,    10,    10,    88,     4
+      81,    84,    85,    86,    87,    89,    90,    91,    93,    94,
+      96,    97,    99,   100,   103,   104,   106,   108,   109,   110,
+     111,   112,   118,   119,   120,   121,   122,   123,   124,   125,
+     127,   128,   130,   133,   134,   135,   136,   138,     8,    81,
+     119,     9,   119,   135,   119,   119,    88,   119,   119,   126,
+     119,   119,     8,   119,   119,     9,    79,   133,   119,     8,
+      81,   135,     8,     9,   119,    74,     9,     9,     0,    96,
+      97,   133,     5,    68,    74,    75,    80,   133,     5,    13,
+      15,    16,    17,    43,    45,    46,    47,    48,    49,    50,
+      51,    52,    55,    56,    57,    58,    59,    60,    65,    66,
+      68,    69,    70,    71,    72,    73,    74,    75,    80,    82,
+     133,   133,    43,   137,     8,    13,   129,     9,   133,    10,
+     117,   119,    10,    10,   119,    12,    44,     9,   133,    98,
+     114,   119,   128,   133,    94,   113,     9,   133,   119,   135,
+     133,     9,    10,   117,    61,   119,   119,     9,   119,   119,
+     119,   119,   119,   119,   119,   119,   119,   119,   119,   119,
+     119,     8,   119,   119,   119,   119,   119,   119,   119,   119,
+     119,   119,   119,   119,   119,     9,   119,   119,    44,   119,
+      43,    47,    12,    10,   116,   135,    94,    10,    12,   119,
+     119,    10,   116,    94,    19,    94,     4,     8,   133,    10,
+     117,     8,   131,    10,    10,    67,   107,    98,    10,    10,
+     114,    44,   114,    83,    44,   119,   119,     8,    53,   102,
+      10,    12,     8,     4,     6,     7,   105,   119,    53,    10,
+      12,     4,   115,   119,     4,    80,     9,    94,    10,    47,
+     133,     4,     8,   126,     4,     7,    67,    19,   135,    19,
+      19,   119,    44,    47,   135,   101,   102,   135,   119,   133,
+     135,    53,    64,    19,   119,    61,     4,    16,    61,   132,
+      47,   133,   133,   133,   126,   119,   129,   115,   115,   119,
+       8,   133,   101,     8,   133,    94,   135,    10,   115,    10,
+      61,   133,   132,    94,    95,    95,   133,    19,    19,    19,
+      95,   133,    94,     4,    53,    10,   133,     4,    95,   119,
+     115,   115,     4,    95,   105,   135,   113,    10,    10,    10,
+       4,   133,   113,    94,   133,     4,    94,     4
 };
 
 #define yyerrok		(yyerrstatus = 0)
@@ -2195,7 +2368,7 @@ yyreduce:
   switch (yyn)
     {
         case 2:
-#line 151 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 160 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		for (auto stmt : *(yyvsp[(1) - (1)].nodes))
 		{
@@ -2207,7 +2380,7 @@ yyreduce:
     break;
 
   case 3:
-#line 163 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 172 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.nodes) = (yyvsp[(1) - (2)].nodes);
 
@@ -2219,7 +2392,7 @@ yyreduce:
     break;
 
   case 4:
-#line 172 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 181 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.nodes) = (yyvsp[(1) - (2)].nodes);
 
@@ -2234,7 +2407,7 @@ yyreduce:
     break;
 
   case 5:
-#line 184 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 193 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.nodes) = new std::vector<ASTNode *>();
 
@@ -2246,7 +2419,7 @@ yyreduce:
     break;
 
   case 6:
-#line 193 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 202 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.nodes) = new std::vector<ASTNode *>();
 
@@ -2261,51 +2434,51 @@ yyreduce:
     break;
 
   case 7:
-#line 207 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 216 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.nodes) = (yyvsp[(1) - (1)].nodes); ;}
     break;
 
   case 8:
-#line 208 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 217 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.nodes) = new std::vector<ASTNode *>(); ;}
     break;
 
   case 9:
-#line 212 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 221 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.node) = (yyvsp[(1) - (2)].stmt); ;}
     break;
 
   case 10:
-#line 213 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 222 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.node) = (yyvsp[(1) - (2)].node); ;}
     break;
 
   case 11:
-#line 214 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 223 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.node) = (yyvsp[(1) - (2)].expr); ;}
     break;
 
   case 12:
-#line 215 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 224 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.node) = nullptr; ;}
     break;
 
   case 13:
-#line 220 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 229 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.nodes) = (yyvsp[(1) - (2)].nodes);
 	;}
     break;
 
   case 14:
-#line 227 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 236 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.nodes) = (yyvsp[(1) - (1)].nodes);
 	;}
     break;
 
   case 15:
-#line 231 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 240 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.nodes) = new std::vector<ASTNode *>();
 		(yyval.nodes)->push_back((yyvsp[(1) - (1)].expr));
@@ -2313,101 +2486,132 @@ yyreduce:
     break;
 
   case 16:
-#line 237 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 246 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
     break;
 
   case 17:
-#line 238 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 247 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
     break;
 
   case 18:
-#line 239 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 248 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
     break;
 
   case 19:
-#line 240 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 249 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
     break;
 
   case 20:
-#line 241 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 250 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
     break;
 
   case 21:
-#line 242 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 251 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
     break;
 
   case 22:
-#line 243 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 252 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
     break;
 
   case 23:
-#line 244 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 253 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
     break;
 
   case 24:
-#line 245 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 254 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
     break;
 
   case 25:
-#line 250 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 255 "/Users/robert/dev/orange/lib/grove/parser.y"
+    { (yyval.stmt) = (yyvsp[(1) - (1)].stmt); ;}
+    break;
+
+  case 26:
+#line 261 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
-		auto func = new Function(*(yyvsp[(2) - (8)].str), std::vector<Parameter *>());
-		func->setReturnType((yyvsp[(5) - (8)].ty));
+		auto func = new Function(*(yyvsp[(2) - (9)].str), std::vector<Parameter *>());
+		func->setReturnType((yyvsp[(5) - (9)].ty));
 
-		for (auto stmt : *(yyvsp[(7) - (8)].nodes))
+		for (auto attr : *(yyvsp[(6) - (9)].strs))
+		{
+			func->addAttribute(attr);
+		}
+
+		for (auto stmt : *(yyvsp[(8) - (9)].nodes))
 		{
 			func->addStatement(stmt);
 		}
 
 		(yyval.stmt) = func;
-        SET_LOCATION((yyval.stmt), (yylsp[(1) - (8)]), (yylsp[(8) - (8)]));
+        SET_LOCATION((yyval.stmt), (yylsp[(1) - (9)]), (yylsp[(9) - (9)]));
 
-		delete (yyvsp[(2) - (8)].str);
-		delete (yyvsp[(7) - (8)].nodes);
+		delete (yyvsp[(2) - (9)].str);
+		delete (yyvsp[(6) - (9)].strs);
+		delete (yyvsp[(8) - (9)].nodes);
 	;}
     break;
 
-  case 26:
-#line 266 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 27:
+#line 284 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
-		auto func = new Function(*(yyvsp[(2) - (9)].str), *(yyvsp[(4) - (9)].params));
-		func->setReturnType((yyvsp[(6) - (9)].ty));
+		auto func = new Function(*(yyvsp[(2) - (10)].str), *(yyvsp[(4) - (10)].params));
+		func->setReturnType((yyvsp[(6) - (10)].ty));
 
-		for (auto stmt : *(yyvsp[(8) - (9)].nodes))
+		for (auto attr : *(yyvsp[(7) - (10)].strs))
+		{
+			func->addAttribute(attr);
+		}
+
+		for (auto stmt : *(yyvsp[(9) - (10)].nodes))
 		{
 			func->addStatement(stmt);
 		}
 
 		(yyval.stmt) = func;
-        SET_LOCATION((yyval.stmt), (yylsp[(1) - (9)]), (yylsp[(9) - (9)]));
+        SET_LOCATION((yyval.stmt), (yylsp[(1) - (10)]), (yylsp[(10) - (10)]));
 
-		delete (yyvsp[(2) - (9)].str);
-		delete (yyvsp[(4) - (9)].params);
-		delete (yyvsp[(8) - (9)].nodes);
+		delete (yyvsp[(2) - (10)].str);
+		delete (yyvsp[(4) - (10)].params);
+		delete (yyvsp[(7) - (10)].strs);
+		delete (yyvsp[(9) - (10)].nodes);
 	;}
     break;
 
-  case 27:
-#line 285 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 28:
+#line 310 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		(yyval.strs) = (yyvsp[(1) - (2)].strs);
+		(yyval.strs)->push_back(*(yyvsp[(2) - (2)].str));
+		delete (yyvsp[(2) - (2)].str);
+	;}
+    break;
+
+  case 29:
+#line 315 "/Users/robert/dev/orange/lib/grove/parser.y"
+    { (yyval.strs) = new std::vector<OString>(); ;}
+    break;
+
+  case 30:
+#line 319 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = (yyvsp[(2) - (2)].ty); ;}
     break;
 
-  case 28:
-#line 286 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 31:
+#line 320 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = nullptr; ;}
     break;
 
-  case 29:
-#line 291 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 32:
+#line 325 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		std::vector<Parameter *> params;
 		(yyval.stmt) = new ExternFunction(*(yyvsp[(2) - (6)].str), params, (yyvsp[(6) - (6)].ty));
@@ -2417,8 +2621,8 @@ yyreduce:
 	;}
     break;
 
-  case 30:
-#line 299 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 33:
+#line 333 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.stmt) = new ExternFunction(*(yyvsp[(2) - (7)].str), *(yyvsp[(4) - (7)].params), (yyvsp[(7) - (7)].ty));
 		SET_LOCATION((yyval.stmt), (yylsp[(1) - (7)]), (yylsp[(7) - (7)]));
@@ -2428,8 +2632,8 @@ yyreduce:
 	;}
     break;
 
-  case 31:
-#line 307 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 34:
+#line 341 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.stmt) = new ExternFunction(*(yyvsp[(2) - (9)].str), *(yyvsp[(4) - (9)].params), (yyvsp[(9) - (9)].ty), true);
 		SET_LOCATION((yyval.stmt), (yylsp[(1) - (9)]), (yylsp[(9) - (9)]));
@@ -2439,8 +2643,8 @@ yyreduce:
 	;}
     break;
 
-  case 32:
-#line 318 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 35:
+#line 352 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto blocks = (yyvsp[(5) - (5)].blocks);
 
@@ -2466,8 +2670,8 @@ yyreduce:
 	;}
     break;
 
-  case 33:
-#line 345 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 36:
+#line 379 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.blocks) = (yyvsp[(5) - (5)].blocks);
 
@@ -2485,8 +2689,8 @@ yyreduce:
 	;}
     break;
 
-  case 34:
-#line 361 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 37:
+#line 395 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.blocks) = new std::vector<Block *>();
 
@@ -2504,15 +2708,95 @@ yyreduce:
 	;}
     break;
 
-  case 35:
-#line 377 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 38:
+#line 411 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.blocks) = new std::vector<Block *>();
 	;}
     break;
 
-  case 36:
-#line 384 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 39:
+#line 418 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		auto switch_stmt = new SwitchStmt((yyvsp[(2) - (5)].expr));
+		for (auto block : *(yyvsp[(4) - (5)].blocks))
+		{
+			switch_stmt->addBlock(block);
+		}
+
+		(yyval.stmt) = switch_stmt;
+		SET_LOCATION((yyval.stmt), (yylsp[(1) - (5)]), (yylsp[(5) - (5)]));
+
+		delete (yyvsp[(4) - (5)].blocks);
+	;}
+    break;
+
+  case 40:
+#line 431 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		auto switch_stmt = new SwitchStmt((yyvsp[(2) - (8)].expr));
+		for (auto block : *(yyvsp[(4) - (8)].blocks))
+		{
+			switch_stmt->addBlock(block);
+		}
+
+		auto block = new Block();
+		for (auto stmt : *(yyvsp[(7) - (8)].nodes))
+		{
+			block->addStatement(stmt);
+		}
+
+		switch_stmt->addBlock(block);
+		SET_LOCATION(block, (yylsp[(5) - (8)]), (yylsp[(8) - (8)]));
+
+		(yyval.stmt) = switch_stmt;
+		SET_LOCATION((yyval.stmt), (yylsp[(1) - (8)]), (yylsp[(8) - (8)]));
+
+		delete (yyvsp[(4) - (8)].blocks);
+		delete (yyvsp[(7) - (8)].nodes);
+	;}
+    break;
+
+  case 41:
+#line 457 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		(yyval.blocks) = (yyvsp[(1) - (5)].blocks);
+
+		auto block = new CaseBlock(*(yyvsp[(3) - (5)].exprs));
+		for (auto stmt : *(yyvsp[(5) - (5)].nodes))
+		{
+			block->addStatement(stmt);
+		}
+
+		(yyval.blocks)->push_back(block);
+		SET_LOCATION(block, (yylsp[(2) - (5)]), (yylsp[(5) - (5)]));
+
+		delete (yyvsp[(3) - (5)].exprs);
+		delete (yyvsp[(5) - (5)].nodes);
+	;}
+    break;
+
+  case 42:
+#line 473 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		(yyval.blocks) = new std::vector<Block *>();
+
+		auto block = new CaseBlock(*(yyvsp[(2) - (4)].exprs));
+		for (auto stmt : *(yyvsp[(4) - (4)].nodes))
+		{
+			block->addStatement(stmt);
+		}
+
+		(yyval.blocks)->push_back(block);
+		SET_LOCATION(block, (yylsp[(1) - (4)]), (yylsp[(4) - (4)]));
+
+		delete (yyvsp[(2) - (4)].exprs);
+		delete (yyvsp[(4) - (4)].nodes);
+	;}
+    break;
+
+  case 43:
+#line 492 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto block = new CondBlock((yyvsp[(2) - (5)].expr), true);
 		for (auto stmt : *(yyvsp[(4) - (5)].nodes))
@@ -2530,8 +2814,8 @@ yyreduce:
 	;}
     break;
 
-  case 37:
-#line 402 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 44:
+#line 510 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto block = new CondBlock((yyvsp[(3) - (3)].expr));
 		block->addStatement((yyvsp[(1) - (3)].node));
@@ -2544,8 +2828,8 @@ yyreduce:
 	;}
     break;
 
-  case 38:
-#line 413 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 45:
+#line 521 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto block = new CondBlock((yyvsp[(3) - (3)].expr));
 		block->addStatement((yyvsp[(1) - (3)].expr));
@@ -2558,8 +2842,8 @@ yyreduce:
 	;}
     break;
 
-  case 39:
-#line 427 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 46:
+#line 535 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto block = new CondBlock((yyvsp[(3) - (3)].expr), true);
 		block->addStatement((yyvsp[(1) - (3)].node));
@@ -2572,8 +2856,8 @@ yyreduce:
 	;}
     break;
 
-  case 40:
-#line 438 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 47:
+#line 546 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto block = new CondBlock((yyvsp[(3) - (3)].expr), true);
 		block->addStatement((yyvsp[(1) - (3)].expr));
@@ -2586,43 +2870,57 @@ yyreduce:
 	;}
     break;
 
-  case 41:
-#line 453 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 48:
+#line 561 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
-		auto loop = new Loop(*(yyvsp[(3) - (11)].nodes), (yyvsp[(5) - (11)].expr), (yyvsp[(7) - (11)].expr), false);
+		auto loop = new Loop(*(yyvsp[(3) - (12)].nodes), (yyvsp[(5) - (12)].expr), (yyvsp[(7) - (12)].expr), false);
 
-	  	for (auto stmt : *(yyvsp[(10) - (11)].nodes))
+	  	for (auto stmt : *(yyvsp[(11) - (12)].nodes))
 		{
 			loop->addStatement(stmt);
 		}
 
+		for (auto hint : *(yyvsp[(9) - (12)].vpairs))
+		{
+			loop->addHint(std::get<0>(hint), std::get<1>(hint));
+			delete std::get<1>(hint);
+		}
+
 		(yyval.stmt) = loop;
-		SET_LOCATION((yyval.stmt), (yylsp[(1) - (11)]), (yylsp[(11) - (11)]));
+		SET_LOCATION((yyval.stmt), (yylsp[(1) - (12)]), (yylsp[(12) - (12)]));
 
-		delete (yyvsp[(3) - (11)].nodes);
-		delete (yyvsp[(10) - (11)].nodes);
+		delete (yyvsp[(3) - (12)].nodes);
+		delete (yyvsp[(9) - (12)].vpairs);
+		delete (yyvsp[(11) - (12)].nodes);
 	;}
     break;
 
-  case 42:
-#line 468 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 49:
+#line 583 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
-		auto loop = new Loop(std::vector<ASTNode*>(), (yyvsp[(2) - (5)].expr), nullptr, false);
+		auto loop = new Loop(std::vector<ASTNode*>(), (yyvsp[(2) - (6)].expr), nullptr, false);
 
-		for (auto stmt : *(yyvsp[(4) - (5)].nodes))
+		for (auto stmt : *(yyvsp[(5) - (6)].nodes))
 		{
 			loop->addStatement(stmt);
 		}
 
+		for (auto hint : *(yyvsp[(3) - (6)].vpairs))
+		{
+			loop->addHint(std::get<0>(hint), std::get<1>(hint));
+			delete std::get<1>(hint);
+		}
+
 		(yyval.stmt) = loop;
-		SET_LOCATION((yyval.stmt), (yylsp[(1) - (5)]), (yylsp[(5) - (5)]));
+		SET_LOCATION((yyval.stmt), (yylsp[(1) - (6)]), (yylsp[(6) - (6)]));
 
-		delete (yyvsp[(4) - (5)].nodes);
+		delete (yyvsp[(3) - (6)].vpairs);
+		delete (yyvsp[(5) - (6)].nodes);
 	;}
     break;
 
-  case 43:
-#line 482 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 50:
+#line 604 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto loop = new Loop(std::vector<ASTNode*>(), nullptr, nullptr, false);
 
@@ -2638,8 +2936,8 @@ yyreduce:
 	;}
     break;
 
-  case 44:
-#line 496 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 51:
+#line 618 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto loop = new Loop(std::vector<ASTNode*>(), (yyvsp[(6) - (6)].expr), nullptr, true);
 
@@ -2655,8 +2953,33 @@ yyreduce:
 	;}
     break;
 
-  case 45:
-#line 514 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 52:
+#line 633 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		auto loop = new ParallelLoop(*(yyvsp[(4) - (13)].nodes), (yyvsp[(6) - (13)].expr), (yyvsp[(8) - (13)].expr));
+
+		for (auto stmt : *(yyvsp[(12) - (13)].nodes))
+		{
+			loop->getBody()->addStatement(stmt);
+		}
+
+		for (auto hint : *(yyvsp[(10) - (13)].vpairs))
+		{
+			loop->addHint(std::get<0>(hint), std::get<1>(hint));
+			delete std::get<1>(hint);
+		}
+
+		(yyval.stmt) = loop;
+		SET_LOCATION((yyval.stmt), (yylsp[(1) - (13)]), (yylsp[(13) - (13)]));
+
+		delete (yyvsp[(4) - (13)].nodes);
+		delete (yyvsp[(10) - (13)].vpairs);
+		delete (yyvsp[(12) - (13)].nodes);
+	;}
+    break;
+
+  case 53:
+#line 659 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto loop = new Loop(*(yyvsp[(4) - (9)].nodes), (yyvsp[(6) - (9)].expr), (yyvsp[(8) - (9)].expr), false);
 		loop->addStatement((yyvsp[(1) - (9)].node));
@@ -2667,8 +2990,8 @@ yyreduce:
 	;}
     break;
 
-  case 46:
-#line 524 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 54:
+#line 669 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto loop = new Loop(*(yyvsp[(4) - (9)].nodes), (yyvsp[(6) - (9)].expr), (yyvsp[(8) - (9)].expr), false);
 		loop->addStatement((yyvsp[(1) - (9)].expr));
@@ -2679,8 +3002,8 @@ yyreduce:
 	;}
     break;
 
-  case 47:
-#line 533 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 55:
+#line 678 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto loop = new Loop(std::vector<ASTNode*>(), (yyvsp[(3) - (3)].expr), nullptr, false);
 		loop->addStatement((yyvsp[(1) - (3)].node));
@@ -2689,8 +3012,8 @@ yyreduce:
 	;}
     break;
 
-  case 48:
-#line 540 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 56:
+#line 685 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto loop = new Loop(std::vector<ASTNode*>(), (yyvsp[(3) - (3)].expr), nullptr, false);
 		loop->addStatement((yyvsp[(1) - (3)].expr));
@@ -2699,8 +3022,8 @@ yyreduce:
 	;}
     break;
 
-  case 49:
-#line 547 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 57:
+#line 692 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto loop = new Loop(std::vector<ASTNode*>(), nullptr, nullptr, false);
 		loop->addStatement((yyvsp[(1) - (2)].node));
@@ -2709,8 +3032,8 @@ yyreduce:
 	;}
     break;
 
-  case 50:
-#line 554 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 58:
+#line 699 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto loop = new Loop(std::vector<ASTNode*>(), nullptr, nullptr, false);
 		loop->addStatement((yyvsp[(1) - (2)].expr));
@@ -2719,28 +3042,52 @@ yyreduce:
 	;}
     break;
 
-  case 51:
-#line 563 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 59:
+#line 709 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		(yyval.vpairs) = (yyvsp[(1) - (5)].vpairs);
+		(yyval.vpairs)->push_back(std::make_tuple(*(yyvsp[(2) - (5)].str), (yyvsp[(4) - (5)].val)));
+		SET_LOCATION((yyvsp[(4) - (5)].val), (yylsp[(4) - (5)]), (yylsp[(4) - (5)]));
+		delete (yyvsp[(2) - (5)].str);
+	;}
+    break;
+
+  case 60:
+#line 716 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		(yyval.vpairs) = (yyvsp[(1) - (2)].vpairs);
+		(yyval.vpairs)->push_back(std::make_tuple(*(yyvsp[(2) - (2)].str), (Value *)nullptr));
+		delete (yyvsp[(2) - (2)].str);
+	;}
+    break;
+
+  case 61:
+#line 721 "/Users/robert/dev/orange/lib/grove/parser.y"
+    { (yyval.vpairs) = new std::vector<std::tuple<OString, Value*>>(); ;}
+    break;
+
+  case 62:
+#line 725 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.nodes) = (yyvsp[(1) - (1)].nodes); ;}
     break;
 
-  case 52:
-#line 564 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 63:
+#line 726 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.nodes) = new std::vector<ASTNode*>(); ;}
     break;
 
-  case 53:
-#line 568 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 64:
+#line 730 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = (yyvsp[(1) - (1)].expr); ;}
     break;
 
-  case 54:
-#line 569 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 65:
+#line 731 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = nullptr; ;}
     break;
 
-  case 55:
-#line 574 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 66:
+#line 736 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.params) = (yyvsp[(1) - (4)].params);
 		auto param = new Parameter((yyvsp[(3) - (4)].ty), *(yyvsp[(4) - (4)].str));
@@ -2751,8 +3098,8 @@ yyreduce:
 	;}
     break;
 
-  case 56:
-#line 583 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 67:
+#line 745 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.params) = new std::vector<Parameter *>();
 		auto param = new Parameter((yyvsp[(1) - (2)].ty), *(yyvsp[(2) - (2)].str));
@@ -2763,212 +3110,212 @@ yyreduce:
 	;}
     break;
 
-  case 57:
-#line 594 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 68:
+#line 756 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.args) = (yyvsp[(1) - (3)].args);
 		(yyval.args)->push_back((yyvsp[(3) - (3)].expr));
 	;}
     break;
 
-  case 58:
-#line 599 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 69:
+#line 761 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.args) = new std::vector<Expression *>();
 		(yyval.args)->push_back((yyvsp[(1) - (1)].expr));
 	;}
     break;
 
-  case 59:
-#line 605 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 70:
+#line 767 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.node) = (yyvsp[(1) - (1)].node); ;}
     break;
 
-  case 60:
-#line 606 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 71:
+#line 768 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.node) = new LoopTerminator(*(yyvsp[(1) - (1)].str)); SET_LOCATION((yyval.node), (yylsp[(1) - (1)]), (yylsp[(1) - (1)])); delete (yyvsp[(1) - (1)].str); ;}
     break;
 
-  case 61:
-#line 607 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 72:
+#line 769 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.node) = new LoopTerminator(*(yyvsp[(1) - (1)].str)); SET_LOCATION((yyval.node), (yylsp[(1) - (1)]), (yylsp[(1) - (1)])); delete (yyvsp[(1) - (1)].str); ;}
     break;
 
-  case 62:
-#line 608 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 73:
+#line 770 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.node) = new LoopTerminator(*(yyvsp[(1) - (1)].str)); SET_LOCATION((yyval.node), (yylsp[(1) - (1)]), (yylsp[(1) - (1)])); delete (yyvsp[(1) - (1)].str); ;}
     break;
 
-  case 63:
-#line 612 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 74:
+#line 774 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = (yyvsp[(1) - (1)].expr); ;}
     break;
 
-  case 64:
-#line 613 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 75:
+#line 775 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = (yyvsp[(1) - (1)].expr); ;}
     break;
 
-  case 65:
-#line 614 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 76:
+#line 776 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = (yyvsp[(1) - (1)].expr); ;}
     break;
 
-  case 66:
-#line 615 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 77:
+#line 777 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = (yyvsp[(1) - (1)].expr); ;}
     break;
 
-  case 67:
-#line 616 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 78:
+#line 778 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = (yyvsp[(1) - (1)].expr); ;}
     break;
 
-  case 68:
-#line 617 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 79:
+#line 779 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = (yyvsp[(1) - (1)].expr); ;}
     break;
 
-  case 69:
-#line 621 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 80:
+#line 783 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpCompare((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 70:
-#line 622 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 81:
+#line 784 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpCompare((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 71:
-#line 623 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 82:
+#line 785 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpCompare((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 72:
-#line 624 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 83:
+#line 786 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpCompare((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 73:
-#line 625 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 84:
+#line 787 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpCompare((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 74:
-#line 626 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 85:
+#line 788 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpCompare((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 75:
-#line 628 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 86:
+#line 790 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpAndOr((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 76:
-#line 629 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 87:
+#line 791 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpAndOr((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 77:
-#line 633 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 88:
+#line 795 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpArith((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 78:
-#line 634 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 89:
+#line 796 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpArith((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 79:
-#line 635 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 90:
+#line 797 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpArith((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 80:
-#line 636 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 91:
+#line 798 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpArith((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 81:
-#line 637 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 92:
+#line 799 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpArith((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 82:
-#line 639 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 93:
+#line 801 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpArith((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 83:
-#line 640 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 94:
+#line 802 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpArith((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 84:
-#line 641 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 95:
+#line 803 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpArith((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 85:
-#line 643 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 96:
+#line 805 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpAssign((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 86:
-#line 644 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 97:
+#line 806 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpAssign((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 87:
-#line 645 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 98:
+#line 807 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpAssign((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 88:
-#line 646 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 99:
+#line 808 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpAssign((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 89:
-#line 647 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 100:
+#line 809 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpAssign((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 90:
-#line 648 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 101:
+#line 810 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new BinOpAssign((yyvsp[(1) - (3)].expr), *(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].str); ;}
     break;
 
-  case 91:
-#line 652 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 102:
+#line 814 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new IncrementExpr((yyvsp[(1) - (2)].expr),  1, false); SET_LOCATION((yyval.expr), (yylsp[(1) - (2)]), (yylsp[(2) - (2)])); ;}
     break;
 
-  case 92:
-#line 653 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 103:
+#line 815 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new IncrementExpr((yyvsp[(1) - (2)].expr), -1, false); SET_LOCATION((yyval.expr), (yylsp[(1) - (2)]), (yylsp[(2) - (2)])); ;}
     break;
 
-  case 93:
-#line 654 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 104:
+#line 816 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new IncrementExpr((yyvsp[(2) - (2)].expr),  1, true); SET_LOCATION((yyval.expr), (yylsp[(1) - (2)]), (yylsp[(2) - (2)])); ;}
     break;
 
-  case 94:
-#line 655 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 105:
+#line 817 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new IncrementExpr((yyvsp[(2) - (2)].expr), -1, true); SET_LOCATION((yyval.expr), (yylsp[(1) - (2)]), (yylsp[(2) - (2)])); ;}
     break;
 
-  case 95:
-#line 660 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 106:
+#line 822 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.expr) = new TernaryExpr((yyvsp[(1) - (5)].expr), (yyvsp[(3) - (5)].expr), (yyvsp[(5) - (5)].expr));
 		SET_LOCATION((yyval.expr), (yylsp[(1) - (5)]), (yylsp[(5) - (5)]));
 	;}
     break;
 
-  case 96:
-#line 668 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 107:
+#line 830 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		std::vector<Expression *> params;
 		(yyval.expr) = new FunctionCall(*(yyvsp[(1) - (3)].str), params);
@@ -2978,8 +3325,8 @@ yyreduce:
 	;}
     break;
 
-  case 97:
-#line 676 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 108:
+#line 838 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.expr) = new FunctionCall(*(yyvsp[(1) - (4)].str), *(yyvsp[(3) - (4)].args));
 		SET_LOCATION((yyval.expr), (yylsp[(1) - (4)]), (yylsp[(4) - (4)]));
@@ -2989,105 +3336,160 @@ yyreduce:
 	;}
     break;
 
-  case 98:
-#line 686 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 109:
+#line 846 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		std::vector<Expression *> params;
+		auto call = new FunctionCall(*(yyvsp[(2) - (4)].str), params);
+		SET_LOCATION(call, (yylsp[(2) - (4)]), (yylsp[(4) - (4)]));
+
+		(yyval.expr) = new ComptimeCall(call);
+		SET_LOCATION((yyval.expr), (yylsp[(1) - (4)]), (yylsp[(4) - (4)]));
+
+		delete (yyvsp[(2) - (4)].str);
+	;}
+    break;
+
+  case 110:
+#line 857 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		auto call = new FunctionCall(*(yyvsp[(2) - (5)].str), *(yyvsp[(4) - (5)].args));
+		SET_LOCATION(call, (yylsp[(2) - (5)]), (yylsp[(5) - (5)]));
+
+		(yyval.expr) = new ComptimeCall(call);
+		SET_LOCATION((yyval.expr), (yylsp[(1) - (5)]), (yylsp[(5) - (5)]));
+
+		delete (yyvsp[(2) - (5)].str);
+		delete (yyvsp[(4) - (5)].args);
+	;}
+    break;
+
+  case 111:
+#line 870 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = (yyvsp[(2) - (3)].expr); ;}
     break;
 
-  case 99:
-#line 687 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 112:
+#line 871 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = (yyvsp[(1) - (1)].val); SET_LOCATION((yyval.expr), (yylsp[(1) - (1)]), (yylsp[(1) - (1)])); ;}
     break;
 
-  case 100:
-#line 688 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 113:
+#line 872 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new NegativeExpr((yyvsp[(2) - (2)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (2)]), (yylsp[(2) - (2)])); ;}
     break;
 
-  case 101:
-#line 689 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 114:
+#line 873 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new StrValue(*(yyvsp[(1) - (1)].str)); SET_LOCATION((yyval.expr), (yylsp[(1) - (1)]), (yylsp[(1) - (1)])); delete (yyvsp[(1) - (1)].str); ;}
     break;
 
-  case 102:
-#line 690 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 115:
+#line 874 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new IDReference(*(yyvsp[(1) - (1)].str)); SET_LOCATION((yyval.expr), (yylsp[(1) - (1)]), (yylsp[(1) - (1)])); delete (yyvsp[(1) - (1)].str); ;}
     break;
 
-  case 103:
-#line 691 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 116:
+#line 875 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new DerefExpr((yyvsp[(2) - (2)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (2)]), (yylsp[(2) - (2)])); ;}
     break;
 
-  case 104:
-#line 692 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 117:
+#line 876 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new ReferenceExpr((yyvsp[(2) - (2)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (2)]), (yylsp[(2) - (2)])); ;}
     break;
 
-  case 105:
-#line 693 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 118:
+#line 877 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new CastExpr((yyvsp[(2) - (4)].ty), (yyvsp[(4) - (4)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (4)]), (yylsp[(4) - (4)])); ;}
     break;
 
-  case 106:
-#line 694 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 119:
+#line 878 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new ArrayValue(*(yyvsp[(2) - (3)].exprs)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(2) - (3)].exprs); ;}
     break;
 
-  case 107:
-#line 695 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 120:
+#line 879 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new ArrayAccessExpr((yyvsp[(1) - (4)].expr), (yyvsp[(3) - (4)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (4)]), (yylsp[(4) - (4)])); ;}
     break;
 
-  case 108:
-#line 696 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 121:
+#line 880 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new AccessExpr((yyvsp[(1) - (3)].expr), *(yyvsp[(3) - (3)].str)); SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); delete (yyvsp[(3) - (3)].str); ;}
     break;
 
-  case 109:
-#line 697 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 122:
+#line 881 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new SizeofExpr((yyvsp[(3) - (4)].expr)); SET_LOCATION((yyval.expr), (yylsp[(1) - (4)]), (yylsp[(4) - (4)])); ;}
     break;
 
-  case 110:
-#line 698 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 123:
+#line 882 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.expr) = new SizeofExpr((yyvsp[(3) - (4)].ty)); SET_LOCATION((yyval.expr), (yylsp[(1) - (4)]), (yylsp[(4) - (4)])); ;}
     break;
 
-  case 111:
-#line 703 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 124:
+#line 884 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		(yyval.expr) = new BuiltinExpr(*(yyvsp[(1) - (3)].str), std::vector<Expression *>());
+		SET_LOCATION((yyval.expr), (yylsp[(1) - (3)]), (yylsp[(3) - (3)]));
+		delete (yyvsp[(1) - (3)].str);
+	;}
+    break;
+
+  case 125:
+#line 890 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		(yyval.expr) = new BuiltinExpr(*(yyvsp[(1) - (4)].str), *(yyvsp[(3) - (4)].args));
+		SET_LOCATION((yyval.expr), (yylsp[(1) - (4)]), (yylsp[(4) - (4)]));
+		delete (yyvsp[(1) - (4)].str);
+		delete (yyvsp[(3) - (4)].args);
+	;}
+    break;
+
+  case 126:
+#line 900 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.exprs) = (yyvsp[(1) - (3)].exprs);
 		(yyval.exprs)->push_back((yyvsp[(3) - (3)].expr));
 	;}
     break;
 
-  case 112:
-#line 708 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 127:
+#line 905 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.exprs) = new std::vector<Expression *>();
 		(yyval.exprs)->push_back((yyvsp[(1) - (1)].expr));
 	;}
     break;
 
-  case 113:
-#line 717 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 128:
+#line 914 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.node) = new ReturnStmt(nullptr);
 		SET_LOCATION((yyval.node), (yylsp[(1) - (1)]), (yylsp[(1) - (1)]));
 	;}
     break;
 
-  case 114:
-#line 722 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 129:
+#line 919 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.node) = new ReturnStmt((yyvsp[(2) - (2)].expr));
 		SET_LOCATION((yyval.node), (yylsp[(1) - (2)]), (yylsp[(2) - (2)]));
 	;}
     break;
 
-  case 115:
-#line 730 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 130:
+#line 924 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		(yyval.node) = new ReturnStmt((yyvsp[(3) - (3)].expr), true);
+		SET_LOCATION((yyval.node), (yylsp[(1) - (3)]), (yylsp[(3) - (3)]));
+	;}
+    break;
+
+  case 131:
+#line 932 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.nodes) = new std::vector<ASTNode*>();
 
@@ -3102,8 +3504,27 @@ yyreduce:
 	;}
     break;
 
-  case 116:
-#line 746 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 132:
+#line 945 "/Users/robert/dev/orange/lib/grove/parser.y"
+    {
+		(yyval.nodes) = new std::vector<ASTNode*>();
+		SET_LOCATION((yyvsp[(3) - (6)].val), (yylsp[(3) - (6)]), (yylsp[(3) - (6)]));
+
+		for (auto tupl : *(yyvsp[(6) - (6)].pairs))
+		{
+			auto decl = new VarDecl((yyvsp[(5) - (6)].ty), std::get<0>(tupl), std::get<1>(tupl));
+			decl->setAlignment((yyvsp[(3) - (6)].val));
+			(yyval.nodes)->push_back(decl);
+			SET_LOCATION(decl, (yylsp[(1) - (6)]), (yylsp[(6) - (6)]));
+		}
+
+		delete (yyvsp[(3) - (6)].val);
+		delete (yyvsp[(6) - (6)].pairs);
+	;}
+    break;
+
+  case 133:
+#line 964 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.pairs) = (yyvsp[(1) - (3)].pairs);
 		(yyval.pairs)->push_back(std::make_tuple(*(yyvsp[(3) - (3)].str), nullptr));
@@ -3112,8 +3533,8 @@ yyreduce:
 	;}
     break;
 
-  case 117:
-#line 753 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 134:
+#line 971 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.pairs) = (yyvsp[(1) - (5)].pairs);
 		(yyval.pairs)->push_back(std::make_tuple(*(yyvsp[(3) - (5)].str), (yyvsp[(5) - (5)].expr)));
@@ -3122,8 +3543,8 @@ yyreduce:
 	;}
     break;
 
-  case 118:
-#line 760 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 135:
+#line 978 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.pairs) = new std::vector<std::tuple<OString, Expression*>>();
 		(yyval.pairs)->push_back(std::make_tuple(*(yyvsp[(1) - (1)].str), nullptr));
@@ -3132,8 +3553,8 @@ yyreduce:
 	;}
     break;
 
-  case 119:
-#line 767 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 136:
+#line 985 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.pairs) = new std::vector<std::tuple<OString, Expression*>>();
 		(yyval.pairs)->push_back(std::make_tuple(*(yyvsp[(1) - (3)].str), (yyvsp[(3) - (3)].expr)));
@@ -3142,8 +3563,8 @@ yyreduce:
 	;}
     break;
 
-  case 120:
-#line 776 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 137:
+#line 994 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		auto estmt = new EnumStmt(*(yyvsp[(2) - (5)].str), IntType::get(64));
 		for (auto pair : *(yyvsp[(4) - (5)].vpairs))
@@ -3159,24 +3580,24 @@ yyreduce:
 	;}
     break;
 
-  case 121:
-#line 792 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 138:
+#line 1010 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.vpairs)->push_back(std::make_tuple(*(yyvsp[(2) - (3)].str), (Value *)nullptr));
 		delete (yyvsp[(2) - (3)].str);
 	;}
     break;
 
-  case 122:
-#line 797 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 139:
+#line 1015 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.vpairs)->push_back(std::make_tuple(*(yyvsp[(2) - (5)].str), (yyvsp[(4) - (5)].val)));
 		delete (yyvsp[(2) - (5)].str);
 	;}
     break;
 
-  case 123:
-#line 802 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 140:
+#line 1020 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.vpairs) = new std::vector<std::tuple<OString, Value*>>();
 		(yyval.vpairs)->push_back(std::make_tuple(*(yyvsp[(1) - (2)].str), (Value *)nullptr));
@@ -3184,8 +3605,8 @@ yyreduce:
 	;}
     break;
 
-  case 124:
-#line 808 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 141:
+#line 1026 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.vpairs) = new std::vector<std::tuple<OString, Value*>>();
 		(yyval.vpairs)->push_back(std::make_tuple(*(yyvsp[(1) - (4)].str), (yyvsp[(3) - (4)].val)));
@@ -3193,16 +3614,16 @@ yyreduce:
 	;}
     break;
 
-  case 125:
-#line 816 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 142:
+#line 1034 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.val) = (yyvsp[(1) - (1)].val);
 		SET_LOCATION((yyval.val), (yylsp[(1) - (1)]), (yylsp[(1) - (1)]));
 	;}
     break;
 
-  case 126:
-#line 821 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 143:
+#line 1039 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.val) = (yyvsp[(2) - (2)].val);
 		(yyvsp[(2) - (2)].val)->negate();
@@ -3210,50 +3631,50 @@ yyreduce:
 	;}
     break;
 
-  case 129:
-#line 835 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 146:
+#line 1053 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.ty) = PointerType::get((yyvsp[(1) - (3)].ty));
 	;}
     break;
 
-  case 130:
-#line 839 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 147:
+#line 1057 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.ty) = PointerType::get((yyvsp[(1) - (2)].ty));
 	;}
     break;
 
-  case 131:
-#line 843 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 148:
+#line 1061 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.ty) = (yyvsp[(1) - (1)].ty);
 	;}
     break;
 
-  case 132:
-#line 850 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 149:
+#line 1068 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.ty) = (yyvsp[(2) - (2)].ty)->getConst();
 	;}
     break;
 
-  case 133:
-#line 854 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 150:
+#line 1072 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.ty) = (yyvsp[(1) - (1)].ty);
 	;}
     break;
 
-  case 134:
-#line 858 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 151:
+#line 1076 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.ty) = (yyvsp[(1) - (1)].ty);
 	;}
     break;
 
-  case 135:
-#line 865 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 152:
+#line 1083 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.ty) = (yyvsp[(1) - (2)].ty);
 
@@ -3287,100 +3708,105 @@ yyreduce:
 	;}
     break;
 
-  case 136:
-#line 900 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 153:
+#line 1118 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.exprs) = (yyvsp[(1) - (4)].exprs);
 		(yyval.exprs)->push_back((yyvsp[(3) - (4)].expr));
 	;}
     break;
 
-  case 137:
-#line 905 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 154:
+#line 1123 "/Users/robert/dev/orange/lib/grove/parser.y"
     {
 		(yyval.exprs) = new std::vector<Expression *>();
 		(yyval.exprs)->push_back((yyvsp[(2) - (3)].expr));
 	;}
     break;
 
-  case 138:
-#line 912 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 155:
+#line 1130 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = IntType::get(64); ;}
     break;
 
-  case 139:
-#line 913 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 156:
+#line 1131 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = UIntType::get(64); ;}
     break;
 
-  case 140:
-#line 914 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 157:
+#line 1132 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = FloatType::get(); ;}
     break;
 
-  case 141:
-#line 915 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 158:
+#line 1133 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = DoubleType::get(); ;}
     break;
 
-  case 142:
-#line 916 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 159:
+#line 1134 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = IntType::get(8); ;}
     break;
 
-  case 143:
-#line 917 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 160:
+#line 1135 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = IntType::get(16); ;}
     break;
 
-  case 144:
-#line 918 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 161:
+#line 1136 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = IntType::get(32); ;}
     break;
 
-  case 145:
-#line 919 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 162:
+#line 1137 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = IntType::get(64); ;}
     break;
 
-  case 146:
-#line 920 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 163:
+#line 1138 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = UIntType::get(8); ;}
     break;
 
-  case 147:
-#line 921 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 164:
+#line 1139 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = UIntType::get(16); ;}
     break;
 
-  case 148:
-#line 922 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 165:
+#line 1140 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = UIntType::get(32); ;}
     break;
 
-  case 149:
-#line 923 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 166:
+#line 1141 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = UIntType::get(64); ;}
     break;
 
-  case 150:
-#line 924 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 167:
+#line 1142 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = IntType::get(8); ;}
     break;
 
-  case 151:
-#line 925 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 168:
+#line 1143 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = VoidType::get(); ;}
     break;
 
-  case 152:
-#line 926 "/Users/robert/dev/orange/lib/grove/parser.y"
+  case 169:
+#line 1144 "/Users/robert/dev/orange/lib/grove/parser.y"
     { (yyval.ty) = VarType::get(); ;}
     break;
 
+  case 170:
+#line 1145 "/Users/robert/dev/orange/lib/grove/parser.y"
+    { (yyval.ty) = VectorType::getNamed(*(yyvsp[(1) - (1)].str)); delete (yyvsp[(1) - (1)].str); ;}
+    break;
+
 
 /* Line 1267 of yacc.c.  */
-#line 3384 "/Users/robert/dev/orange/lib/grove/parser.cc"
+#line 3810 "/Users/robert/dev/orange/lib/grove/parser.cc"
       default: break;
     }
   YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
@@ -3600,6 +4026,6 @@ yyreturn:
 }
 
 
-#line 929 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 1148 "/Users/robert/dev/orange/lib/grove/parser.y"
 
 
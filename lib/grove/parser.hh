@@ -121,7 +121,13 @@
      QUESTION = 337,
      COLON = 338,
      ENUM = 339,
-     SIZEOF = 340
+     SIZEOF = 340,
+     SWITCH = 341,
+     PARALLEL = 342,
+     TAILCALL = 343,
+     INTRINSIC = 344,
+     ALIGN = 345,
+     TYPE_VECTOR = 346
    };
 #endif
 /* Tokens.  */
@@ -208,13 +214,19 @@
 #define COLON 338
 #define ENUM 339
 #define SIZEOF 340
+#define SWITCH 341
+#define PARALLEL 342
+#define TAILCALL 343
+#define INTRINSIC 344
+#define ALIGN 345
+#define TYPE_VECTOR 346
 
 
 
 
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 typedef union YYSTYPE
-#line 72 "/Users/robert/dev/orange/lib/grove/parser.y"
+#line 78 "/Users/robert/dev/orange/lib/grove/parser.y"
 {
 	std::vector<ASTNode*>* nodes;
 	std::vector<Parameter*>* params;
@@ -223,6 +235,7 @@ typedef union YYSTYPE
 	std::vector<Expression*>* exprs;
 	std::vector<std::tuple<OString, Expression*>>* pairs;
 	std::vector<std::tuple<OString, Value*>>* vpairs;
+	std::vector<OString>* strs;
 	ASTNode* node;
 	Block* block;
 	Expression* expr;
@@ -232,7 +245,7 @@ typedef union YYSTYPE
 	Type* ty;
 }
 /* Line 1529 of yacc.c.  */
-#line 236 "/Users/robert/dev/orange/lib/grove/parser.hh"
+#line 249 "/Users/robert/dev/orange/lib/grove/parser.hh"
 	YYSTYPE;
 # define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
@@ -13,7 +13,10 @@
 	#include <grove/CondBlock.h>
 	#include <grove/Function.h>
 	#include <grove/IfStmt.h>
+	#include <grove/SwitchStmt.h>
+	#include <grove/CaseBlock.h>
 	#include <grove/FunctionCall.h>
+	#include <grove/ComptimeCall.h>
 	#include <grove/ExternFunction.h>
 	#include <grove/Value.h>
 	#include <grove/StrValue.h>
@@ -30,6 +33,7 @@
 	#include <grove/IncrementExpr.h>
 	#include <grove/Loop.h>
 	#include <grove/LoopTerminator.h>
+	#include <grove/ParallelLoop.h>
 	#include <grove/DerefExpr.h>
 	#include <grove/ReferenceExpr.h>
 	#include <grove/CastExpr.h>
@@ -39,6 +43,7 @@
 	#include <grove/AccessExpr.h>
 	#include <grove/EnumStmt.h>
 	#include <grove/SizeofExpr.h>
+	#include <grove/BuiltinExpr.h>
 	#include <grove/OString.h>
 
 	#include <grove/types/Type.h>
@@ -51,6 +56,7 @@
 	#include <grove/types/VarType.h>
 	#include <grove/types/ArrayType.h>
 	#include <grove/types/VariadicArrayType.h>
+	#include <grove/types/VectorType.h>
 
 	#include <util/assertions.h>
 
@@ -77,6 +83,7 @@
 	std::vector<Expression*>* exprs;
 	std::vector<std::tuple<OString, Expression*>>* pairs;
 	std::vector<std::tuple<OString, Value*>>* vpairs;
+	std::vector<OString>* strs;
 	ASTNode* node;
 	Block* block;
 	Expression* expr;
@@ -98,26 +105,28 @@
 %token DOT LEQ GEQ COMP_LT COMP_GT MOD VALUE STRING EXTERN VARARG EQUALS NEQUALS WHEN
 %token UNLESS LOGICAL_AND LOGICAL_OR BITWISE_AND BITWISE_OR BITWISE_XOR
 %token FOR FOREVER LOOP CONTINUE BREAK DO WHILE
-%token CONST_FLAG QUESTION COLON ENUM SIZEOF
+%token CONST_FLAG QUESTION COLON ENUM SIZEOF SWITCH PARALLEL TAILCALL INTRINSIC
+%token ALIGN TYPE_VECTOR
 
 %type <nodes> opt_statements statements compound_statement var_decl valued
 %type <nodes> opt_valued
 %type <node> statement return controls
 %type <exprs> expr_list array_def_list
 %type <pairs> var_decl_list
-%type <vpairs> enum_members
-%type <blocks> else_if_or_end
+%type <vpairs> enum_members opt_loop_hints
+%type <blocks> else_if_or_end switch_cases
 %type <expr> expression primary comparison arithmetic call increment
 %type <expr> opt_expression ternary
 %type <stmt> structures function extern_function ifs inline_if unless
-%type <stmt> inline_unless for_loop inline_for_loop enum_stmt
+%type <stmt> inline_unless for_loop inline_for_loop enum_stmt switch_stmt
 %type <val> VALUE pos_or_neg_value
 %type <str> COMP_LT COMP_GT LEQ GEQ PLUS MINUS TYPE_ID STRING TIMES DIVIDE ASSIGN
 %type <str> EQUALS NEQUALS PLUS_ASSIGN TIMES_ASSIGN MINUS_ASSIGN DIVIDE_ASSIGN
 %type <str> MOD MOD_ASSIGN BITWISE_AND BITWISE_OR BITWISE_XOR LOGICAL_AND
-%type <str> LOGICAL_OR LOOP CONTINUE BREAK
+%type <str> LOGICAL_OR LOOP CONTINUE BREAK INTRINSIC TYPE_VECTOR
 %type <ty> type basic_type type_hint non_agg_type array_type
 %type <params> param_list
+%type <strs> opt_function_attrs
 %type <args> arg_list
 
 /* lowest to highest precedence */
@@ -243,42 +252,67 @@ structures
 	| for_loop { $$ = $1; }
 	| inline_for_loop { $$ = $1; }
 	| enum_stmt { $$ = $1; }
+	| switch_stmt { $$ = $1; }
 	;
 
 function
- 	: DEF TYPE_ID OPEN_PAREN CLOSE_PAREN type_hint term opt_statements END
+ 	: DEF TYPE_ID OPEN_PAREN CLOSE_PAREN type_hint opt_function_attrs term
+	  opt_statements END
 	{
 		auto func = new Function(*$2, std::vector<Parameter *>());
 		func->setReturnType($5);
 
-		for (auto stmt : *$7)
+		for (auto attr : *$6)
+		{
+			func->addAttribute(attr);
+		}
+
+		for (auto stmt : *$8)
 		{
 			func->addStatement(stmt);
 		}
 
 		$$ = func;
-        SET_LOCATION($$, @1, @8);
+        SET_LOCATION($$, @1, @9);
 
 		delete $2;
-		delete $7;
+		delete $6;
+		delete $8;
 	}
-	| DEF TYPE_ID OPEN_PAREN param_list CLOSE_PAREN type_hint term opt_statements END
+	| DEF TYPE_ID OPEN_PAREN param_list CLOSE_PAREN type_hint opt_function_attrs
+	  term opt_statements END
 	{
 		auto func = new Function(*$2, *$4);
 		func->setReturnType($6);
 
-		for (auto stmt : *$8)
+		for (auto attr : *$7)
+		{
+			func->addAttribute(attr);
+		}
+
+		for (auto stmt : *$9)
 		{
 			func->addStatement(stmt);
 		}
 
 		$$ = func;
-        SET_LOCATION($$, @1, @9);
+        SET_LOCATION($$, @1, @10);
 
 		delete $2;
 		delete $4;
-		delete $8;
+		delete $7;
+		delete $9;
+	}
+	;
+
+opt_function_attrs
+	: opt_function_attrs TYPE_ID
+	{
+		$$ = $1;
+		$$->push_back(*$2);
+		delete $2;
 	}
+	| { $$ = new std::vector<OString>(); }
 	;
 
 type_hint
@@ -379,6 +413,80 @@ else_if_or_end
 	}
 	;
 
+switch_stmt
+	: SWITCH expression term switch_cases END
+	{
+		auto switch_stmt = new SwitchStmt($2);
+		for (auto block : *$4)
+		{
+			switch_stmt->addBlock(block);
+		}
+
+		$$ = switch_stmt;
+		SET_LOCATION($$, @1, @5);
+
+		delete $4;
+	}
+	| SWITCH expression term switch_cases ELSE term opt_statements END
+	{
+		auto switch_stmt = new SwitchStmt($2);
+		for (auto block : *$4)
+		{
+			switch_stmt->addBlock(block);
+		}
+
+		auto block = new Block();
+		for (auto stmt : *$7)
+		{
+			block->addStatement(stmt);
+		}
+
+		switch_stmt->addBlock(block);
+		SET_LOCATION(block, @5, @8);
+
+		$$ = switch_stmt;
+		SET_LOCATION($$, @1, @8);
+
+		delete $4;
+		delete $7;
+	}
+	;
+
+switch_cases
+	: switch_cases WHEN expr_list term opt_statements
+	{
+		$$ = $1;
+
+		auto block = new CaseBlock(*$3);
+		for (auto stmt : *$5)
+		{
+			block->addStatement(stmt);
+		}
+
+		$$->push_back(block);
+		SET_LOCATION(block, @2, @5);
+
+		delete $3;
+		delete $5;
+	}
+	| WHEN expr_list term opt_statements
+	{
+		$$ = new std::vector<Block *>();
+
+		auto block = new CaseBlock(*$2);
+		for (auto stmt : *$4)
+		{
+			block->addStatement(stmt);
+		}
+
+		$$->push_back(block);
+		SET_LOCATION(block, @1, @4);
+
+		delete $2;
+		delete $4;
+	}
+	;
+
 unless
 	: UNLESS expression term statements END
 	{
@@ -449,34 +557,48 @@ inline_unless
 
 for_loop
 	: FOR OPEN_PAREN opt_valued SEMICOLON opt_expression SEMICOLON opt_expression
-	  CLOSE_PAREN term statements END
+	  CLOSE_PAREN opt_loop_hints term statements END
 	{
 		auto loop = new Loop(*$3, $5, $7, false);
 
-	  	for (auto stmt : *$10)
+	  	for (auto stmt : *$11)
 		{
 			loop->addStatement(stmt);
 		}
 
+		for (auto hint : *$9)
+		{
+			loop->addHint(std::get<0>(hint), std::get<1>(hint));
+			delete std::get<1>(hint);
+		}
+
 		$$ = loop;
-		SET_LOCATION($$, @1, @11);
+		SET_LOCATION($$, @1, @12);
 
 		delete $3;
-		delete $10;
+		delete $9;
+		delete $11;
 	}
-	| WHILE expression term statements END
+	| WHILE expression opt_loop_hints term statements END
 	{
 		auto loop = new Loop(std::vector<ASTNode*>(), $2, nullptr, false);
 
-		for (auto stmt : *$4)
+		for (auto stmt : *$5)
 		{
 			loop->addStatement(stmt);
 		}
 
+		for (auto hint : *$3)
+		{
+			loop->addHint(std::get<0>(hint), std::get<1>(hint));
+			delete std::get<1>(hint);
+		}
+
 		$$ = loop;
-		SET_LOCATION($$, @1, @5);
+		SET_LOCATION($$, @1, @6);
 
-		delete $4;
+		delete $3;
+		delete $5;
 	}
 	| FOREVER DO term statements END
 	{
@@ -506,6 +628,29 @@ for_loop
 
 		delete $3;
 	}
+	| PARALLEL FOR OPEN_PAREN valued SEMICOLON expression SEMICOLON expression
+	  CLOSE_PAREN opt_loop_hints term statements END
+	{
+		auto loop = new ParallelLoop(*$4, $6, $8);
+
+		for (auto stmt : *$12)
+		{
+			loop->getBody()->addStatement(stmt);
+		}
+
+		for (auto hint : *$10)
+		{
+			loop->addHint(std::get<0>(hint), std::get<1>(hint));
+			delete std::get<1>(hint);
+		}
+
+		$$ = loop;
+		SET_LOCATION($$, @1, @13);
+
+		delete $4;
+		delete $10;
+		delete $12;
+	}
 	;
 
 inline_for_loop
@@ -559,6 +704,23 @@ inline_for_loop
 	}
 	;
 
+opt_loop_hints
+	: opt_loop_hints TYPE_ID OPEN_PAREN VALUE CLOSE_PAREN
+	{
+		$$ = $1;
+		$$->push_back(std::make_tuple(*$2, $4));
+		SET_LOCATION($4, @4, @4);
+		delete $2;
+	}
+	| opt_loop_hints TYPE_ID
+	{
+		$$ = $1;
+		$$->push_back(std::make_tuple(*$2, (Value *)nullptr));
+		delete $2;
+	}
+	| { $$ = new std::vector<std::tuple<OString, Value*>>(); }
+	;
+
 opt_valued
 	: valued { $$ = $1; }
 	| { $$ = new std::vector<ASTNode*>(); }
@@ -680,6 +842,28 @@ call
 		delete $1;
 		delete $3;
 	}
+	| CONST_FLAG TYPE_ID OPEN_PAREN CLOSE_PAREN
+	{
+		std::vector<Expression *> params;
+		auto call = new FunctionCall(*$2, params);
+		SET_LOCATION(call, @2, @4);
+
+		$$ = new ComptimeCall(call);
+		SET_LOCATION($$, @1, @4);
+
+		delete $2;
+	}
+	| CONST_FLAG TYPE_ID OPEN_PAREN arg_list CLOSE_PAREN
+	{
+		auto call = new FunctionCall(*$2, *$4);
+		SET_LOCATION(call, @2, @5);
+
+		$$ = new ComptimeCall(call);
+		SET_LOCATION($$, @1, @5);
+
+		delete $2;
+		delete $4;
+	}
 	;
 
 primary
@@ -696,6 +880,19 @@ primary
 	| expression DOT TYPE_ID { $$ = new AccessExpr($1, *$3); SET_LOCATION($$, @1, @3); delete $3; }
 	| SIZEOF OPEN_PAREN expression CLOSE_PAREN { $$ = new SizeofExpr($3); SET_LOCATION($$, @1, @4); }
 	| SIZEOF OPEN_PAREN type CLOSE_PAREN { $$ = new SizeofExpr($3); SET_LOCATION($$, @1, @4); }
+	| INTRINSIC OPEN_PAREN CLOSE_PAREN
+	{
+		$$ = new BuiltinExpr(*$1, std::vector<Expression *>());
+		SET_LOCATION($$, @1, @3);
+		delete $1;
+	}
+	| INTRINSIC OPEN_PAREN arg_list CLOSE_PAREN
+	{
+		$$ = new BuiltinExpr(*$1, *$3);
+		SET_LOCATION($$, @1, @4);
+		delete $1;
+		delete $3;
+	}
 	;
 
 expr_list
@@ -723,6 +920,11 @@ return
 		$$ = new ReturnStmt($2);
 		SET_LOCATION($$, @1, @2);
 	}
+	| RETURN TAILCALL expression
+	{
+		$$ = new ReturnStmt($3, true);
+		SET_LOCATION($$, @1, @3);
+	}
 	;
 
 var_decl
@@ -739,6 +941,22 @@ var_decl
 
 		delete $2;
 	}
+	| ALIGN OPEN_PAREN VALUE CLOSE_PAREN type var_decl_list
+	{
+		$$ = new std::vector<ASTNode*>();
+		SET_LOCATION($3, @3, @3);
+
+		for (auto tupl : *$6)
+		{
+			auto decl = new VarDecl($5, std::get<0>(tupl), std::get<1>(tupl));
+			decl->setAlignment($3);
+			$$->push_back(decl);
+			SET_LOCATION(decl, @1, @6);
+		}
+
+		delete $3;
+		delete $6;
+	}
 	;
 
 var_decl_list
@@ -924,6 +1142,7 @@ basic_type
 	| TYPE_CHAR { $$ = IntType::get(8); }
 	| TYPE_VOID { $$ = VoidType::get(); }
 	| TYPE_VAR { $$ = VarType::get(); }
+	| TYPE_VECTOR { $$ = VectorType::getNamed(*$1); delete $1; }
 	;
 
 %%
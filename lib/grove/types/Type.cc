@@ -8,6 +8,8 @@
 
 #include <grove/types/Type.h>
 #include <grove/types/PointerType.h>
+#include <grove/types/ArrayType.h>
+#include <grove/types/VectorType.h>
 
 #include <grove/exceptions/fatal_error.h>
 
@@ -23,6 +25,9 @@
 
 #include <util/assertions.h>
 
+#include <cstdint>
+#include <vector>
+
 std::map<std::string, Type*> Type::m_defined;
 std::map<TypeTuple, TypeCast> Type::m_cast_map;
 std::map<TypeTuple, TypeCallback> Type::m_cast_ty_map;
@@ -122,6 +127,11 @@ bool Type::isVarTy() const
 	return false;
 }
 
+bool Type::isVectorTy() const
+{
+	return false;
+}
+
 bool Type::isConst() const
 {
 	return m_const;
@@ -279,13 +289,20 @@ std::string Type::getSignature() const
 	throw fatal_error("Type::getSignature not overriden");
 }
 
-int Type::castOperation(Type *to)
+int Type::castOperation(Type *to, CodeBase *element)
 {
 	if (this == to)
 	{
 		return 0;
 	}
 	
+	// Vectors are cast lane by lane.
+	if (to->isVectorTy())
+	{
+		return VectorType::getCastOperation(this, to->as<VectorType *>(),
+											element);
+	}
+	
 	TypeTuple key(typeid(*this).hash_code(), typeid(*to).hash_code());
 	
 	// Search for callbacks first.
@@ -300,6 +317,12 @@ int Type::castOperation(Type *to)
 
 llvm::Value* Type::cast(void *irBuilder, Valued *val, Type *target)
 {
+	if (target->isVectorTy() && this != target)
+	{
+		return VectorType::createCast(irBuilder, val, this,
+									  target->as<VectorType *>());
+	}
+	
 	TypeTuple key(typeid(*this).hash_code(), typeid(*target).hash_code());
 	
 	auto it = m_cast_map.find(key);
@@ -330,6 +353,31 @@ Comparison Type::compare(Type *source, Type *target)
 		return Comparison::EQUAL;
 	}
 	
+	// A scalar used with a vector is copied to each lane. Vectors can only
+	// be used with vectors that have the same lanes.
+	if (source->isVectorTy() && target->isVectorTy())
+	{
+		if (source->as<VectorType *>()->getSize() !=
+			target->as<VectorType *>()->getSize() ||
+			compare(source->getBaseTy(), target->getBaseTy()) !=
+			Comparison::EQUAL)
+		{
+			return Comparison::INCOMPATIBLE;
+		}
+		
+		return Comparison::EQUAL;
+	}
+	else if (source->isVectorTy())
+	{
+		return target->isPODTy() ? Comparison::HIGHER_PRECEDENCE :
+			Comparison::INCOMPATIBLE;
+	}
+	else if (target->isVectorTy())
+	{
+		return source->isPODTy() ? Comparison::LOWER_PRECEDENCE :
+			Comparison::INCOMPATIBLE;
+	}
+	
 	if (source->isIntTy() && target->isPointerTy())
 	{
 		return Comparison::HIGHER_PRECEDENCE;
@@ -412,6 +460,52 @@ std::vector<Expression *> Type::getVariadicSizes() const
 	return std::vector<Expression *>();
 }
 
+Type* Type::getFoldedTy() const
+{
+	auto sizes = getVariadicSizes();
+	if (sizes.size() == 0)
+	{
+		return (Type *)this;
+	}
+	
+	std::vector<unsigned int> folded;
+	for (auto size : sizes)
+	{
+		auto val = size->fold();
+		
+		bool valid = val != nullptr && val->getType()->isIntTy() &&
+			(val->getType()->isSigned() ? val->getInt() >= 0 : true) &&
+			val->getUInt() <= UINT32_MAX;
+		
+		if (valid == false)
+		{
+			delete val;
+			return (Type *)this;
+		}
+		
+		folded.push_back(exprAsArrSize(val));
+		delete val;
+	}
+	
+	// Rebuild the array from the innermost dimension out, keeping the
+	// constness of each dimension.
+	std::vector<bool> consts;
+	
+	Type* ty = (Type *)this;
+	while (ty->isVariadiclySized())
+	{
+		consts.push_back(ty->isConst());
+		ty = ty->getBaseTy();
+	}
+	
+	for (int i = (int)folded.size() - 1; i >= 0; i--)
+	{
+		ty = ArrayType::get(ty, folded[i], consts[i]);
+	}
+	
+	return ty;
+}
+
 Type::Type(bool isConst)
 {
 	m_context = & llvm::getGlobalContext();
@@ -0,0 +1,282 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <grove/types/VectorType.h>
+#include <grove/types/IntType.h>
+#include <grove/types/UIntType.h>
+#include <grove/types/FloatType.h>
+#include <grove/types/DoubleType.h>
+
+#include <grove/Valued.h>
+#include <grove/ASTNode.h>
+
+#include <grove/exceptions/fatal_error.h>
+#include <grove/exceptions/code_error.h>
+
+#include <util/assertions.h>
+
+#include <llvm/IR/Type.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/IRBuilder.h>
+
+#include <cstdlib>
+
+VectorType::VectorType(Type* contained, unsigned int size, bool isConst)
+: Type(isConst)
+{
+	if (contained == nullptr)
+	{
+		throw fatal_error("contained was null");
+	}
+	
+	if (contained->isIntTy() == false && contained->isFloatingPointTy() == false
+		&& contained->isBoolTy() == false)
+	{
+		throw fatal_error("vectors can only contain numbers or booleans");
+	}
+	
+	if (size == 0)
+	{
+		throw fatal_error("tried to create a vector with no lanes");
+	}
+	
+	m_contained = contained;
+	m_size = size;
+	
+	m_type = llvm::VectorType::get(m_contained->getLLVMType(), m_size);
+}
+
+std::string VectorType::getSignature(Type* contained, unsigned int size,
+									 bool isConst)
+{
+	std::stringstream ss;
+	
+	if (isConst)
+	{
+		ss << getConstIdentifier();
+	}
+	
+	ss << "V" << size << contained->getSignature();
+	return ss.str();
+}
+
+std::string VectorType::getString() const
+{
+	std::stringstream ss;
+	
+	if (isConst())
+	{
+		ss << "const ";
+	}
+	
+	ss << m_contained->getString() << "x" << m_size;
+	return ss.str();
+}
+
+std::string VectorType::getSignature() const
+{
+	return getSignature(m_contained, m_size, isConst());
+}
+
+unsigned int VectorType::getSize() const
+{
+	return m_size;
+}
+
+bool VectorType::isSigned() const
+{
+	return m_contained->isSigned();
+}
+
+bool VectorType::isVectorTy() const
+{
+	return true;
+}
+
+Type* VectorType::getBaseTy() const
+{
+	return m_contained;
+}
+
+Type* VectorType::getRootTy() const
+{
+	return m_contained->getRootTy();
+}
+
+Type* VectorType::getConst() const
+{
+	return VectorType::get(m_contained, m_size, true);
+}
+
+int VectorType::getCastOperation(Type* from, VectorType* to,
+								 CodeBase* element)
+{
+	assertExists(element, "element must exist");
+	
+	auto from_elem = from;
+	
+	if (from->isVectorTy() || from->isArrayTy())
+	{
+		unsigned int from_size = 0;
+		
+		if (from->isVectorTy())
+		{
+			from_size = from->as<VectorType *>()->getSize();
+		}
+		else if (from->isVariadiclySized())
+		{
+			throw code_error(element, []() -> std::string
+				{
+					return "can't cast an array whose size isn't known to "
+						"a vector";
+				});
+		}
+		else
+		{
+			auto llvm_ty = llvm::cast<llvm::ArrayType>(from->getLLVMType());
+			from_size = llvm_ty->getNumElements();
+		}
+		
+		if (from_size != to->getSize())
+		{
+			auto to_size = to->getSize();
+			throw code_error(element, [from_size, to_size]() -> std::string
+				{
+					std::stringstream ss;
+					ss << "vector cast needs the same number of lanes, but "
+					   << from_size << " lanes can't be cast to " << to_size;
+					return ss.str();
+				});
+		}
+		
+		from_elem = from->getBaseTy();
+	}
+	
+	// Casting a number to a bool compares it to zero, which isn't a cast
+	// operation.
+	if (to->getBaseTy()->isBoolTy() && from_elem->isBoolTy() == false)
+	{
+		throw code_error(element, []() -> std::string
+			{
+				return "can't cast lanes of a vector to bool";
+			});
+	}
+	
+	return from_elem->castOperation(to->getBaseTy(), element);
+}
+
+llvm::Value* VectorType::createCast(void* irBuilder, Valued* val, Type* from,
+									VectorType* to)
+{
+	assertExists(irBuilder, "irbuilder must exist");
+	assertExists(val, "val must exist");
+	assertExists(from, "from must exist");
+	assertExists(to, "to must exist");
+	
+	LLVMBuilder* IRB = (LLVMBuilder *)irBuilder;
+	
+	if (from->isVectorTy() == false && from->isArrayTy() == false)
+	{
+		auto elem = from->cast(irBuilder, val, to->getBaseTy());
+		return IRB->CreateVectorSplat(to->getSize(), elem);
+	}
+	
+	auto op = (llvm::Instruction::CastOps)getCastOperation(from, to,
+		val->as<CodeBase *>());
+	auto llvm_val = val->getValue();
+	assertExists(llvm_val, "valued didn't have value");
+	
+	if (from->isVectorTy())
+	{
+		if (op == NO_CAST)
+		{
+			return llvm_val;
+		}
+		
+		return IRB->CreateCast(op, llvm_val, to->getLLVMType());
+	}
+	
+	// Move each element of the array into its lane.
+	llvm::Value* vec = llvm::UndefValue::get(to->getLLVMType());
+	
+	for (unsigned int i = 0; i < to->getSize(); i++)
+	{
+		auto elem = IRB->CreateExtractValue(llvm_val, i);
+		
+		if (op != NO_CAST)
+		{
+			elem = IRB->CreateCast(op, elem, to->getBaseTy()->getLLVMType());
+		}
+		
+		vec = IRB->CreateInsertElement(vec, elem, IRB->getInt32(i));
+	}
+	
+	return vec;
+}
+
+VectorType* VectorType::getNamed(std::string name)
+{
+	auto split = name.rfind('x');
+	if (split == std::string::npos)
+	{
+		throw fatal_error("vector type name doesn't have a size");
+	}
+	
+	auto elem = name.substr(0, split);
+	auto size = (unsigned int)std::strtoul(name.c_str() + split + 1,
+										   nullptr, 10);
+	
+	Type* contained = nullptr;
+	
+	if (elem == "float" || elem == "float32")
+	{
+		contained = FloatType::get();
+	}
+	else if (elem == "double" || elem == "float64")
+	{
+		contained = DoubleType::get();
+	}
+	else if (elem.compare(0, 4, "uint") == 0)
+	{
+		auto width = elem.size() > 4 ? std::atoi(elem.c_str() + 4) : 64;
+		contained = UIntType::get(width);
+	}
+	else if (elem.compare(0, 3, "int") == 0)
+	{
+		auto width = elem.size() > 3 ? std::atoi(elem.c_str() + 3) : 64;
+		contained = IntType::get(width);
+	}
+	else
+	{
+		throw fatal_error("unknown vector element type " + elem);
+	}
+	
+	return VectorType::get(contained, size);
+}
+
+VectorType* VectorType::get(Type* contained, unsigned int size, bool isConst)
+{
+	if (contained == nullptr)
+	{
+		throw fatal_error("contained was null");
+	}
+	
+	auto signature = getSignature(contained, size, isConst);
+	
+	auto defined = getDefined(signature);
+	if (defined != nullptr)
+	{
+		return defined->as<VectorType *>();
+	}
+	
+	VectorType* ty = new VectorType(contained, size, isConst);
+	define(signature, ty);
+	
+	return ty;
+}
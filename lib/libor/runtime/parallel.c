@@ -0,0 +1,325 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <libor/parallel.h>
+
+#ifdef _WIN32
+
+// Windows programs don't link against pthreads; run loops serially.
+void orange_parallel_for(int64_t begin, int64_t end, orange_parallel_body body,
+                         void* ctx)
+{
+	if (begin < end)
+	{
+		body(begin, end, ctx);
+	}
+}
+
+#else
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/// The number of chunks each worker gets when a loop is split up.
+#define CHUNKS_PER_WORKER 4
+
+/// Upper bound on the number of workers, including the calling thread.
+#define MAX_WORKERS 64
+
+/// A loop being run by the pool. Lives on the stack of the calling thread.
+struct job
+{
+	orange_parallel_body body;
+	void* ctx;
+
+	/// The number of chunks that haven't finished running.
+	int64_t pending;
+
+	pthread_mutex_t lock;
+	pthread_cond_t done;
+};
+
+/// A chunk of iterations of a job.
+struct task
+{
+	struct job* job;
+	int64_t lo;
+	int64_t hi;
+};
+
+/**
+ * A worker's queue of tasks. The owner takes tasks from the bottom; other
+ * workers steal from the top, so the owner and thieves work on opposite ends
+ * of the range.
+ */
+struct deque
+{
+	pthread_mutex_t lock;
+	struct task tasks[CHUNKS_PER_WORKER];
+	unsigned int top;
+	unsigned int bottom;
+};
+
+static struct
+{
+	/// The number of workers, including the thread that submits a job.
+	unsigned int workers;
+
+	/// Deque 0 belongs to the submitting thread.
+	struct deque deques[MAX_WORKERS];
+
+	/// Bumped every time a job is submitted to wake up the workers.
+	unsigned long generation;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+
+	/// Held while a job runs; the pool only runs one job at a time.
+	pthread_mutex_t submit;
+} pool;
+
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+
+/// Set on threads that are running a parallel body.
+static __thread int in_parallel = 0;
+
+static int pop_bottom(struct deque* dq, struct task* t)
+{
+	int found = 0;
+
+	pthread_mutex_lock(&dq->lock);
+
+	if (dq->top != dq->bottom)
+	{
+		*t = dq->tasks[--dq->bottom];
+		found = 1;
+	}
+
+	pthread_mutex_unlock(&dq->lock);
+	return found;
+}
+
+static int steal_top(struct deque* dq, struct task* t)
+{
+	int found = 0;
+
+	pthread_mutex_lock(&dq->lock);
+
+	if (dq->top != dq->bottom)
+	{
+		*t = dq->tasks[dq->top++];
+		found = 1;
+	}
+
+	pthread_mutex_unlock(&dq->lock);
+	return found;
+}
+
+static void run_task(struct task* t)
+{
+	t->job->body(t->lo, t->hi, t->job->ctx);
+
+	pthread_mutex_lock(&t->job->lock);
+
+	if (--t->job->pending == 0)
+	{
+		pthread_cond_signal(&t->job->done);
+	}
+
+	pthread_mutex_unlock(&t->job->lock);
+}
+
+/// Runs tasks from worker id's deque, stealing from the other workers when it
+/// runs dry. Returns when no deque has any tasks left.
+static void run_tasks(unsigned int id)
+{
+	struct task t;
+
+	for (;;)
+	{
+		if (pop_bottom(&pool.deques[id], &t))
+		{
+			run_task(&t);
+			continue;
+		}
+
+		int stole = 0;
+
+		for (unsigned int i = 1; i < pool.workers; i++)
+		{
+			unsigned int victim = (id + i) % pool.workers;
+
+			if (steal_top(&pool.deques[victim], &t))
+			{
+				stole = 1;
+				break;
+			}
+		}
+
+		if (stole == 0)
+		{
+			return;
+		}
+
+		run_task(&t);
+	}
+}
+
+static void* worker_main(void* arg)
+{
+	unsigned int id = (unsigned int)(uintptr_t)arg;
+	unsigned long seen = 0;
+
+	in_parallel = 1;
+
+	for (;;)
+	{
+		pthread_mutex_lock(&pool.lock);
+
+		while (pool.generation == seen)
+		{
+			pthread_cond_wait(&pool.wake, &pool.lock);
+		}
+
+		seen = pool.generation;
+		pthread_mutex_unlock(&pool.lock);
+
+		run_tasks(id);
+	}
+
+	return NULL;
+}
+
+static void init_pool(void)
+{
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (cpus < 1)
+	{
+		cpus = 1;
+	}
+	else if (cpus > MAX_WORKERS)
+	{
+		cpus = MAX_WORKERS;
+	}
+
+	for (unsigned int i = 0; i < MAX_WORKERS; i++)
+	{
+		pthread_mutex_init(&pool.deques[i].lock, NULL);
+	}
+
+	pthread_mutex_init(&pool.lock, NULL);
+	pthread_cond_init(&pool.wake, NULL);
+	pthread_mutex_init(&pool.submit, NULL);
+
+	pool.workers = 1;
+
+	for (unsigned int i = 1; i < (unsigned int)cpus; i++)
+	{
+		pthread_t thread;
+
+		// Workers are numbered in order, so stop at the first failure.
+		if (pthread_create(&thread, NULL, worker_main,
+		                   (void*)(uintptr_t)i) != 0)
+		{
+			break;
+		}
+
+		pthread_detach(thread);
+		pool.workers++;
+	}
+}
+
+void orange_parallel_for(int64_t begin, int64_t end, orange_parallel_body body,
+                         void* ctx)
+{
+	if (begin >= end)
+	{
+		return;
+	}
+
+	if (in_parallel)
+	{
+		body(begin, end, ctx);
+		return;
+	}
+
+	pthread_once(&pool_once, init_pool);
+
+	uint64_t count = (uint64_t)end - (uint64_t)begin;
+	uint64_t max_chunks = (uint64_t)pool.workers * CHUNKS_PER_WORKER;
+	uint64_t chunk = (count + max_chunks - 1) / max_chunks;
+
+	if (pool.workers == 1 || count < 2)
+	{
+		body(begin, end, ctx);
+		return;
+	}
+
+	pthread_mutex_lock(&pool.submit);
+
+	struct job job;
+	job.body = body;
+	job.ctx = ctx;
+	job.pending = (int64_t)((count + chunk - 1) / chunk);
+	pthread_mutex_init(&job.lock, NULL);
+	pthread_cond_init(&job.done, NULL);
+
+	// Deal the chunks out round-robin. A worker still looking for work from
+	// the last job may pick them up before the wake-up below; that's fine.
+	unsigned int worker = 0;
+
+	for (int64_t lo = begin; lo < end; )
+	{
+		int64_t hi = (uint64_t)(end - lo) > chunk ? lo + (int64_t)chunk : end;
+		struct deque* dq = &pool.deques[worker];
+
+		pthread_mutex_lock(&dq->lock);
+
+		if (dq->top == dq->bottom)
+		{
+			dq->top = dq->bottom = 0;
+		}
+
+		dq->tasks[dq->bottom].job = &job;
+		dq->tasks[dq->bottom].lo = lo;
+		dq->tasks[dq->bottom].hi = hi;
+		dq->bottom++;
+
+		pthread_mutex_unlock(&dq->lock);
+
+		worker = (worker + 1) % pool.workers;
+		lo = hi;
+	}
+
+	pthread_mutex_lock(&pool.lock);
+	pool.generation++;
+	pthread_cond_broadcast(&pool.wake);
+	pthread_mutex_unlock(&pool.lock);
+
+	// The calling thread works on the job too.
+	in_parallel = 1;
+	run_tasks(0);
+	in_parallel = 0;
+
+	pthread_mutex_lock(&job.lock);
+
+	while (job.pending != 0)
+	{
+		pthread_cond_wait(&job.done, &job.lock);
+	}
+
+	pthread_mutex_unlock(&job.lock);
+
+	pthread_cond_destroy(&job.done);
+	pthread_mutex_destroy(&job.lock);
+
+	pthread_mutex_unlock(&pool.submit);
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*
+** Copyright 2014-2015 Robert Fratto. See the LICENSE.txt file at the top-level
+** directory of this distribution.
+**
+** Licensed under the MIT license <http://opensource.org/licenses/MIT>. This file
+** may not be copied, modified, or distributed except according to those terms.
+*/
+
+#include <libor/profile.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/// Where the profile goes when ORANGE_PROFILE_FILE isn't set.
+#define DEFAULT_PROFILE_FILE "default.orprof"
+
+void orange_profile_write(const struct orange_profile_record* records,
+                          uint64_t count)
+{
+	const char* path = getenv("ORANGE_PROFILE_FILE");
+
+	if (path == NULL || path[0] == '\0')
+	{
+		path = DEFAULT_PROFILE_FILE;
+	}
+
+	FILE* file = fopen(path, "w");
+
+	if (file == NULL)
+	{
+		fprintf(stderr, "orange: could not open %s to write the profile\n",
+		        path);
+		return;
+	}
+
+	for (uint64_t i = 0; i < count; i++)
+	{
+		const struct orange_profile_record* rec = &records[i];
+
+		fprintf(file, "%s %" PRIu64 " %" PRIu64, rec->name, rec->hash,
+		        rec->num_counters);
+
+		for (uint64_t j = 0; j < rec->num_counters; j++)
+		{
+			fprintf(file, " %" PRIu64, rec->counters[j]);
+		}
+
+		fprintf(file, "\n");
+	}
+
+	fclose(file);
+}
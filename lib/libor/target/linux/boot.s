@@ -15,7 +15,8 @@ _start:
 	callq _main
 	movq %rax, %rdi
 
-	movq $60, %rax
+	# exit_group, so worker threads of the runtime don't keep the process alive
+	movq $231, %rax
 	syscall
 .exit:
 	jmp .exit
@@ -10,6 +10,7 @@
 #include <memory>
 #include <orange/BuildCommand.h>
 #include <grove/Builder.h>
+#include <grove/BuildSettings.h>
 #include <cmd/StateFlag.h>
 
 int BuildCommand::run(std::vector<std::string> args)
@@ -24,11 +25,69 @@ int BuildCommand::run(std::vector<std::string> args)
 	// Run a thing.
 	std::string program_to_run = args[0];
 	
+	auto emit_kind = EMIT_OBJ;
+	if (m_emit->getUsed())
+	{
+		auto kind = m_emit->getValue();
+		
+		if (kind == "obj")
+		{
+			emit_kind = EMIT_OBJ;
+		}
+		else if (kind == "asm")
+		{
+			emit_kind = EMIT_ASM;
+		}
+		else if (kind == "llvm")
+		{
+			emit_kind = EMIT_LLVM;
+		}
+		else if (kind == "bc")
+		{
+			emit_kind = EMIT_BC;
+		}
+		else
+		{
+			std::cerr << "unknown kind of output " << kind << ".\n";
+			std::cerr << "--emit must be one of llvm, bc, asm, or obj.\n";
+			return 1;
+		}
+	}
+	
 	try {
-		auto builder = new Builder(program_to_run);
+		auto settings = new BuildSettings();
+		settings->setShareInstances(m_share_instances->getUsed());
+		settings->setBoundsCheck(m_bounds_check->getUsed());
+		
+		if (m_inline_threshold->getUsed())
+		{
+			settings->setInlineThreshold(
+				std::stoi(m_inline_threshold->getValue()));
+		}
+		
+		settings->setProfileGenerate(m_profile_generate->getUsed());
+		settings->setFastMath(m_fast_math->getUsed());
+		settings->setEmitUnoptimized(m_pre_opt->getUsed());
+		
+		if (m_profile_use->getUsed())
+		{
+			settings->setProfileUse(m_profile_use->getValue());
+		}
+		
+		auto builder = new Builder(program_to_run, settings);
 		builder->compile();
 		
-		if (m_output->getUsed())
+		if (m_stats->getUsed())
+		{
+			builder->printStatistics(std::cerr);
+		}
+		
+		if (m_emit->getUsed())
+		{
+			builder->emit(m_output->getUsed() ? m_output->getValue() : "",
+						  emit_kind);
+		}
+		else if (m_output->getUsed())
 		{
 			builder->link(m_output->getValue());
 		}
@@ -51,5 +110,53 @@ BuildCommand::BuildCommand()
 {
 	m_output = std::shared_ptr<StateFlag>(new StateFlag("o", "output", true));
 	
+	m_stats = std::shared_ptr<StateFlag>(new StateFlag("stats", false));
+	m_stats->setDescription("Print compiler statistics after compiling.");
+	
+	m_share_instances = std::shared_ptr<StateFlag>(
+		new StateFlag("share-instances", false));
+	m_share_instances->setDescription("Define each generic instance in only "
+		"one module of the build.");
+	
+	m_bounds_check = std::shared_ptr<StateFlag>(
+		new StateFlag("bounds-check", false));
+	m_bounds_check->setDescription("Trap on out of bounds array accesses.");
+	
+	m_inline_threshold = std::shared_ptr<StateFlag>(
+		new StateFlag("inline-threshold", true));
+	m_inline_threshold->setDescription("Set how large a function can be and "
+		"still be inlined (default 225).");
+	
+	m_profile_generate = std::shared_ptr<StateFlag>(
+		new StateFlag("profile-generate", false));
+	m_profile_generate->setDescription("Count branches and calls, writing "
+		"them to default.orprof or $ORANGE_PROFILE_FILE when main returns.");
+	
+	m_fast_math = std::shared_ptr<StateFlag>(
+		new StateFlag("fast-math", false));
+	m_fast_math->setDescription("Optimize floating point math as if it were "
+		"exact, assuming no NaNs or infinities.");
+	
+	m_profile_use = std::shared_ptr<StateFlag>(
+		new StateFlag("profile-use", true));
+	m_profile_use->setDescription("Optimize using a profile written by a "
+		"program built with --profile-generate.");
+	
 	addFlag(m_output.get());
+	addFlag(m_stats.get());
+	addFlag(m_share_instances.get());
+	addFlag(m_bounds_check.get());
+	m_emit = std::shared_ptr<StateFlag>(new StateFlag("emit", true));
+	m_emit->setDescription("Write each module as llvm, bc, asm, or obj "
+		"instead of linking.");
+	
+	m_pre_opt = std::shared_ptr<StateFlag>(new StateFlag("pre-opt", false));
+	m_pre_opt->setDescription("Emit the code from before it was optimized.");
+	
+	addFlag(m_inline_threshold.get());
+	addFlag(m_profile_generate.get());
+	addFlag(m_profile_use.get());
+	addFlag(m_fast_math.get());
+	addFlag(m_emit.get());
+	addFlag(m_pre_opt.get());
 }
@@ -7,8 +7,11 @@
 */
 
 #include <iostream>
+#include <memory>
 #include <orange/RunCommand.h>
 #include <grove/Builder.h>
+#include <grove/BuildSettings.h>
+#include <cmd/StateFlag.h>
 
 int RunCommand::run(std::vector<std::string> args)
 {
@@ -23,9 +26,31 @@ int RunCommand::run(std::vector<std::string> args)
 	std::string program_to_run = args[0];
 
 	try {
-		auto builder = new Builder(program_to_run);
+		auto settings = new BuildSettings();
+		settings->setBoundsCheck(m_bounds_check->getUsed());
+
+		if (m_inline_threshold->getUsed())
+		{
+			settings->setInlineThreshold(
+				std::stoi(m_inline_threshold->getValue()));
+		}
+
+		settings->setProfileGenerate(m_profile_generate->getUsed());
+		settings->setFastMath(m_fast_math->getUsed());
+
+		if (m_profile_use->getUsed())
+		{
+			settings->setProfileUse(m_profile_use->getValue());
+		}
+
+		auto builder = new Builder(program_to_run, settings);
 		builder->compile();
 
+		if (m_stats->getUsed())
+		{
+			builder->printStatistics(std::cerr);
+		}
+
 		int result = builder->run();
 
 		if (result != 0)
@@ -45,5 +70,37 @@ int RunCommand::run(std::vector<std::string> args)
 RunCommand::RunCommand()
 : OptionsState("run")
 {
-	// Do nothing.
+	m_stats = std::shared_ptr<StateFlag>(new StateFlag("stats", false));
+	m_stats->setDescription("Print compiler statistics after compiling.");
+
+	m_bounds_check = std::shared_ptr<StateFlag>(
+		new StateFlag("bounds-check", false));
+	m_bounds_check->setDescription("Trap on out of bounds array accesses.");
+
+	m_inline_threshold = std::shared_ptr<StateFlag>(
+		new StateFlag("inline-threshold", true));
+	m_inline_threshold->setDescription("Set how large a function can be and "
+		"still be inlined (default 225).");
+
+	m_profile_generate = std::shared_ptr<StateFlag>(
+		new StateFlag("profile-generate", false));
+	m_profile_generate->setDescription("Count branches and calls, writing "
+		"them to default.orprof or $ORANGE_PROFILE_FILE when main returns.");
+
+	m_fast_math = std::shared_ptr<StateFlag>(
+		new StateFlag("fast-math", false));
+	m_fast_math->setDescription("Optimize floating point math as if it were "
+		"exact, assuming no NaNs or infinities.");
+
+	m_profile_use = std::shared_ptr<StateFlag>(
+		new StateFlag("profile-use", true));
+	m_profile_use->setDescription("Optimize using a profile written by a "
+		"program built with --profile-generate.");
+
+	addFlag(m_stats.get());
+	addFlag(m_bounds_check.get());
+	addFlag(m_inline_threshold.get());
+	addFlag(m_profile_generate.get());
+	addFlag(m_profile_use.get());
+	addFlag(m_fast_math.get());
 }
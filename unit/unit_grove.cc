@@ -10,22 +10,34 @@
 #include <test/Comparisons.h>
 
 #include <grove/Builder.h>
+#include <grove/BuildSettings.h>
+#include <grove/Module.h>
+#include <grove/Function.h>
+#include <grove/VarDecl.h>
+#include <grove/Profile.h>
+
+#include <grove/types/Type.h>
 
 #include <grove/exceptions/file_error.h>
 #include <grove/exceptions/already_defined_error.h>
 #include <grove/exceptions/already_defined_sig_error.h>
 #include <grove/exceptions/undefined_error.h>
 #include <grove/exceptions/binop_error.h>
+#include <grove/exceptions/invalid_type_error.h>
 
+#include <llvm/IR/Module.h>
 #include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Path.h>
+#include <llvm/ADT/SmallString.h>
 
 #include <util/file.h>
 #include <util/link.h>
 #include <util/string.h>
 
 #include <sstream>
+#include <stdexcept>
 #include <cstdio>
+#include <cstdlib>
 #include <fstream>
 
 
@@ -230,6 +242,684 @@ TEST_EXCEPTION(TestInvalidBinOpOperands, binop_error, R"EOF(
 	var foo = ptr + 2.3
 )EOF");
 
+TEST_EXCEPTION(TestDuplicateSwitchCases, code_error, R"EOF(
+	var a = 5
+	switch a
+	when 1, 2
+		return 1
+	when 3, 2
+		return 2
+	end
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestNonConstantSwitchCase, code_error, R"EOF(
+	var a = 5
+	var b = 6
+	switch a
+	when b
+		return 1
+	end
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestSwitchCaseOutOfRange, code_error, R"EOF(
+	var a = 44i8
+	switch a
+	when 44
+		return 1
+	when 300
+		return 2
+	end
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestUnknownLoopHint, code_error, R"EOF(
+	var a = 0
+	for (var i = 0; i < 10; i++) vectorise(4)
+		a++
+	end
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestInvalidLoopHintValue, code_error, R"EOF(
+	var a = 0
+	for (var i = 0; i < 10; i++) unroll(0)
+		a++
+	end
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestAssertVectorizedWidthOne, code_error, R"EOF(
+	var a = 0
+	for (var i = 0; i < 10; i++) vectorize(1) assert_vectorized
+		a++
+	end
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestBreakInParallelFor, code_error, R"EOF(
+	int[10] a
+	parallel for (var i = 0; i < 10; i++)
+		break if i == 5
+		a[i] = i
+	end
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestParallelForCondition, code_error, R"EOF(
+	int[10] a
+	parallel for (var i = 0; i != 10; i++)
+		a[i] = i
+	end
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestSwitchOnDouble, invalid_type_error, R"EOF(
+	var a = 5.0
+	switch a
+	when 5
+		return 1
+	end
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestConstCallRuntimeArgument, code_error, R"EOF(
+	def twice(int a)
+		return a * 2
+	end
+	var a = 5
+	var b = const twice(a)
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestConstCallDivideByZero, code_error, R"EOF(
+	def divide(int a, int b)
+		return a / b
+	end
+	var a = const divide(1, 0)
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestTailCallNotACall, code_error, R"EOF(
+	def foo(int a)
+		return tailcall a + 1
+	end
+	return foo(1)
+)EOF");
+
+TEST_EXCEPTION(TestTailCallMismatchedParams, code_error, R"EOF(
+	def bar(int a, int b)
+		return a + b
+	end
+	def foo(int a)
+		return tailcall bar(a, 1)
+	end
+	return foo(1)
+)EOF");
+
+TEST_EXCEPTION(TestTailCallFromMain, code_error, R"EOF(
+	def foo()
+		return 1
+	end
+	return tailcall foo()
+)EOF");
+
+TEST_EXCEPTION(TestBswapOddBytes, invalid_type_error, R"EOF(
+	var a = 5u8
+	return bswap(a)
+)EOF");
+
+TEST_EXCEPTION(TestPrefetchNonConstant, code_error, R"EOF(
+	var a = 5
+	var rw = 1
+	prefetch(&a, rw)
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestAlignNotPowerOfTwo, code_error, R"EOF(
+	align(24) int[8] a
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestAtomicStoreAcquire, code_error, R"EOF(
+	var a = 5
+	atomic_store(&a, 1, acquire)
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestShuffleIndexOutOfRange, code_error, R"EOF(
+	int32x4 a = 1i32
+	var b = shuffle(a, 0, 4)
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestVectorCastLaneMismatch, code_error, R"EOF(
+	int32x4 a = [1i32, 2i32, 3i32]
+	return 0
+)EOF");
+
+TEST_EXCEPTION(TestVectorTooManyLanes, std::runtime_error, R"EOF(
+	int8x99999999 a = 1i8
+	return 0
+)EOF");
+
+ADD_TEST(TestGenericInstanceReuse, "Test reusing instances of a generic.");
+int TestGenericInstanceReuse()
+{
+	auto temp_path = getTempFile("test", "or");
+	std::ofstream file(temp_path);
+	
+	if (file.is_open() == false)
+	{
+		std::cerr << "Couldn't open " << temp_path << std::endl;
+		std::remove(temp_path.c_str());
+		return 1;
+	}
+	
+	// The int8 argument is casted to b's type, so the first two calls
+	// should share an instance.
+	file << R"EOF(
+		def template_add(var a, int b)
+			return a + b
+		end
+		
+		var x = template_add(3, 5)
+		var y = template_add(3, 5i8)
+		var z = template_add(3.0, 5)
+		var w = template_add(3, 5)
+		return 0
+	)EOF";
+	file.close();
+	
+	auto builder = new Builder(temp_path);
+	builder->compile();
+	
+	Function* generic = nullptr;
+	for (auto func : builder->getModules()[0]->getMain()->findChildren<Function *>())
+	{
+		if (func->isGeneric())
+		{
+			generic = func;
+		}
+	}
+	
+	std::remove(temp_path.c_str());
+	
+	if (generic == nullptr)
+	{
+		delete builder;
+		return fail();
+	}
+	
+	auto instances = generic->getInstances().size();
+	auto hits = generic->getInstanceHits();
+	delete builder;
+	
+	ASSERT_EQ(instances, (size_t)2);
+	ASSERT_EQ(hits >= 2, true);
+	return pass();
+}
+
+ADD_TEST(TestInstanceMangledNames, "Test mangling the module into instances.");
+int TestInstanceMangledNames()
+{
+	auto temp_path = getTempFile("test", "or");
+	std::ofstream file(temp_path);
+	
+	if (file.is_open() == false)
+	{
+		std::cerr << "Couldn't open " << temp_path << std::endl;
+		std::remove(temp_path.c_str());
+		return 1;
+	}
+	
+	file << R"EOF(
+		def template_mul(var a, var b)
+			return a * b
+		end
+		
+		var x = template_mul(3, 5)
+		var y = template_mul(3.0, 5.0)
+		return 0
+	)EOF";
+	file.close();
+	
+	auto builder = new Builder(temp_path);
+	builder->compile();
+	
+	std::remove(temp_path.c_str());
+	
+	auto module = builder->getModules()[0];
+	
+	std::stringstream prefix;
+	prefix << "_O" << module->getMangledName() << "12template_mul";
+	
+	std::vector<std::string> names;
+	for (auto func : module->getMain()->findChildren<Function *>())
+	{
+		if (func->isInstance())
+		{
+			names.push_back(func->getMangledName().str());
+		}
+	}
+	
+	delete builder;
+	
+	ASSERT_EQ(names.size(), (size_t)2);
+	ASSERT_EQ(names[0] != names[1], true);
+	ASSERT_EQ(names[0].compare(0, prefix.str().size(), prefix.str()), 0);
+	ASSERT_EQ(names[1].compare(0, prefix.str().size(), prefix.str()), 0);
+	return pass();
+}
+
+ADD_TEST(TestModuleNamesUsePath, "Test mangling the path of a module.");
+int TestModuleNamesUsePath()
+{
+	// Write util.or to two directories.
+	std::vector<std::string> paths;
+	
+	for (int i = 0; i < 2; i++)
+	{
+		llvm::SmallString<128> dir;
+		if (llvm::sys::fs::createUniqueDirectory("test", dir))
+		{
+			return fail();
+		}
+		
+		llvm::sys::path::append(dir, "util.or");
+		paths.push_back(dir.str());
+		
+		std::ofstream file(paths.back());
+		file << "return 0" << std::endl;
+		file.close();
+	}
+	
+	std::vector<std::string> names;
+	
+	for (auto path : paths)
+	{
+		auto builder = new Builder(path);
+		names.push_back(builder->getModules()[0]->getMangledName());
+		delete builder;
+	}
+	
+	// Building the same file again gives the same name.
+	auto builder = new Builder(paths[0]);
+	names.push_back(builder->getModules()[0]->getMangledName());
+	delete builder;
+	
+	for (auto path : paths)
+	{
+		llvm::sys::fs::remove(path);
+		llvm::sys::fs::remove(llvm::sys::path::parent_path(path));
+	}
+	
+	ASSERT_EQ(names[0] != names[1], true);
+	ASSERT_EQ(names[0], names[2]);
+	return pass();
+}
+
+ADD_TEST(TestStringLiteralsPooled, "Test sharing identical string literals.");
+int TestStringLiteralsPooled()
+{
+	auto temp_path = getTempFile("test", "or");
+	std::ofstream file(temp_path);
+	
+	if (file.is_open() == false)
+	{
+		std::cerr << "Couldn't open " << temp_path << std::endl;
+		std::remove(temp_path.c_str());
+		return 1;
+	}
+	
+	// Each instance of log builds the format string again.
+	file << R"EOF(
+		extern printf(char *s, ...) -> int32
+		
+		def log(var a)
+			printf("value: %d\n", a)
+		end
+		
+		log(1)
+		log(2i8)
+		printf("value: %d\n", 3)
+		printf("done\n")
+		return 0
+	)EOF";
+	file.close();
+	
+	auto builder = new Builder(temp_path);
+	builder->compile();
+	
+	std::remove(temp_path.c_str());
+	
+	auto globals = builder->getModules()[0]->getLLVMModule()
+		->getGlobalList().size();
+	delete builder;
+	
+	ASSERT_EQ(globals, (size_t)2);
+	return pass();
+}
+
+ADD_TEST(TestFoldedArraySizes, "Test fixing array sizes known at compile time.");
+int TestFoldedArraySizes()
+{
+	auto temp_path = getTempFile("test", "or");
+	std::ofstream file(temp_path);
+	
+	if (file.is_open() == false)
+	{
+		std::cerr << "Couldn't open " << temp_path << std::endl;
+		std::remove(temp_path.c_str());
+		return 1;
+	}
+	
+	file << R"EOF(
+		enum Sizes
+			SMALL = 2
+		end
+		
+		const int rows = Sizes.SMALL * 3
+		
+		int[rows][(int)1.5 + 1] a
+		int[sizeof(int32) * 2 - rows] b
+		int[-(-4)] c
+		return 0
+	)EOF";
+	file.close();
+	
+	auto builder = new Builder(temp_path);
+	builder->compile();
+	
+	std::remove(temp_path.c_str());
+	
+	size_t variadic = 0;
+	for (auto decl : builder->getModules()[0]->getMain()->findChildren<VarDecl *>())
+	{
+		if (decl->getType()->isVariadiclySized())
+		{
+			variadic++;
+		}
+	}
+	
+	delete builder;
+	
+	ASSERT_EQ(variadic, (size_t)0);
+	return pass();
+}
+
+ADD_TEST(TestProfileRoundTrip, "Test writing a profile and building with it.");
+int TestProfileRoundTrip()
+{
+	auto temp_path = getTempFile("test", "or");
+	auto profile_path = getTempFile("test", "orprof");
+	std::ofstream file(temp_path);
+	
+	if (file.is_open() == false)
+	{
+		std::cerr << "Couldn't open " << temp_path << std::endl;
+		std::remove(temp_path.c_str());
+		return 1;
+	}
+	
+	file << R"EOF(
+		def classify(int a) -> int
+			if a % 10 == 0
+				return 1
+			end
+			
+			return 0
+		end
+		
+		var hits = 0
+		for (var i = 0; i < 1000; i++)
+			hits += classify(i)
+		end
+		
+		if hits != 100
+			return 1
+		end
+		
+		return 0
+	)EOF";
+	file.close();
+	
+#ifdef _WIN32
+	_putenv_s("ORANGE_PROFILE_FILE", profile_path.c_str());
+#else
+	setenv("ORANGE_PROFILE_FILE", profile_path.c_str(), 1);
+#endif
+	
+	auto settings = new BuildSettings();
+	settings->setProfileGenerate(true);
+	
+	auto builder = new Builder(temp_path, settings);
+	builder->compile();
+	auto generate_result = builder->run();
+	delete builder;
+	
+#ifdef _WIN32
+	// Setting a variable to nothing removes it on Windows.
+	_putenv_s("ORANGE_PROFILE_FILE", "");
+#else
+	unsetenv("ORANGE_PROFILE_FILE");
+#endif
+	
+	Profile profile(profile_path);
+	
+	settings = new BuildSettings();
+	settings->setProfileUse(profile_path);
+	
+	builder = new Builder(temp_path, settings);
+	builder->compile();
+	auto use_result = builder->run();
+	delete builder;
+	
+	std::remove(temp_path.c_str());
+	std::remove(profile_path.c_str());
+	
+	ASSERT_EQ(generate_result, 0);
+	ASSERT_EQ(profile.getMaxEntryCount(), (uint64_t)1000);
+	ASSERT_EQ(use_result, 0);
+	return pass();
+}
+
+ADD_TEST(TestEmitUnoptimizedIR, "Test writing a module as unoptimized LLVM IR.");
+int TestEmitUnoptimizedIR()
+{
+	auto temp_path = getTempFile("test", "or");
+	auto ir_path = getTempFile("test", "ll");
+	std::ofstream file(temp_path);
+	
+	if (file.is_open() == false)
+	{
+		std::cerr << "Couldn't open " << temp_path << std::endl;
+		std::remove(temp_path.c_str());
+		return 1;
+	}
+	
+	file << R"EOF(
+		var a = 5
+		return a - 5
+	)EOF";
+	file.close();
+	
+	auto settings = new BuildSettings();
+	settings->setEmitUnoptimized(true);
+	
+	auto builder = new Builder(temp_path, settings);
+	builder->compile();
+	builder->emit(ir_path, EMIT_LLVM);
+	delete builder;
+	
+	std::ifstream ir(ir_path);
+	std::stringstream contents;
+	contents << ir.rdbuf();
+	ir.close();
+	
+	std::remove(temp_path.c_str());
+	std::remove(ir_path.c_str());
+	
+	// Before mem2reg runs, the variable still lives in a stack slot.
+	ASSERT_EQ(contents.str().find("define") != std::string::npos, true);
+	ASSERT_EQ(contents.str().find("alloca") != std::string::npos, true);
+	return pass();
+}
+
+/// Builds source with settings and returns the LLVM IR of its module.
+std::string getIR(std::string source, BuildSettings* settings)
+{
+	auto temp_path = getTempFile("test", "or");
+	auto ir_path = getTempFile("test", "ll");
+	
+	std::ofstream file(temp_path);
+	file << source;
+	file.close();
+	
+	auto builder = new Builder(temp_path, settings);
+	builder->compile();
+	builder->emit(ir_path, EMIT_LLVM);
+	delete builder;
+	
+	std::ifstream ir(ir_path);
+	std::stringstream contents;
+	contents << ir.rdbuf();
+	ir.close();
+	
+	std::remove(temp_path.c_str());
+	std::remove(ir_path.c_str());
+	
+	return contents.str();
+}
+
+/// Builds source with bounds checks and returns the LLVM IR of its module.
+std::string getBoundsCheckedIR(std::string source, bool unoptimized)
+{
+	auto settings = new BuildSettings();
+	settings->setBoundsCheck(true);
+	settings->setEmitUnoptimized(unoptimized);
+	
+	return getIR(source, settings);
+}
+
+ADD_TEST(TestBoundsCheckTraps, "Test trapping on an out of range index.");
+int TestBoundsCheckTraps()
+{
+	// Once optimized, a check that always fails calls llvm.trap and one
+	// that always passes is removed.
+	auto out_of_range = getBoundsCheckedIR(R"EOF(
+		int[4] a
+		var i = 7
+		a[i] = 1
+		return 0
+	)EOF", false);
+	
+	auto in_range = getBoundsCheckedIR(R"EOF(
+		int[4] a
+		var i = 3
+		a[i] = 1
+		return 0
+	)EOF", false);
+	
+	auto trap = "call void @llvm.trap()";
+	
+	ASSERT_EQ(out_of_range.find(trap) != std::string::npos, true);
+	ASSERT_EQ(in_range.find(trap) == std::string::npos, true);
+	return pass();
+}
+
+ADD_TEST(TestHoistedBoundsCheck, "Test checking a counting loop's range once.");
+int TestHoistedBoundsCheck()
+{
+	// A check in the body would branch to an inbounds block on every
+	// iteration; the range is checked before the loop instead.
+	auto ir = getBoundsCheckedIR(R"EOF(
+		def fill(int n)
+			int[16] a
+			for (var i = 0; i < n; i++)
+				a[i] = i
+			end
+		end
+		
+		fill(10)
+		return 0
+	)EOF", true);
+	
+	ASSERT_EQ(ir.find("label %trap") != std::string::npos, true);
+	ASSERT_EQ(ir.find("label %inbounds") == std::string::npos, true);
+	return pass();
+}
+
+ADD_TEST(TestGuardedBoundsCheck, "Test checking an access under an if where it runs.");
+int TestGuardedBoundsCheck()
+{
+	// The loop runs past the end of a, but the access doesn't, so it can't
+	// be checked against the range of the loop.
+	auto ir = getBoundsCheckedIR(R"EOF(
+		def fill(int n)
+			int[4] a
+			for (var i = 0; i < n; i++)
+				if i < 4
+					a[i] = i
+				end
+			end
+		end
+		
+		fill(10)
+		return 0
+	)EOF", true);
+	
+	ASSERT_EQ(ir.find("label %inbounds") != std::string::npos, true);
+	return pass();
+}
+
+ADD_TEST(TestShortCircuitBoundsCheck, "Test checking an access after && where it runs.");
+int TestShortCircuitBoundsCheck()
+{
+	auto ir = getBoundsCheckedIR(R"EOF(
+		def count(int n)
+			int[4] a
+			var total = 0
+			for (var i = 0; i < n; i++)
+				var zero = i < 4 && a[i] == 0
+				total += zero ? 1 : 0
+			end
+			return total
+		end
+		
+		count(10)
+		return 0
+	)EOF", true);
+	
+	ASSERT_EQ(ir.find("label %inbounds") != std::string::npos, true);
+	return pass();
+}
+
+ADD_TEST(TestUnlessBranchWeights, "Test weighting the branch of an unless.");
+int TestUnlessBranchWeights()
+{
+	// The branch goes past the body when the condition is true, so that
+	// side gets the likely weight.
+	auto settings = new BuildSettings();
+	settings->setEmitUnoptimized(true);
+	
+	auto ir = getIR(R"EOF(
+		def check(int a)
+			unless likely(a == 0)
+				return 1
+			end
+			return 0
+		end
+		
+		return check(0)
+	)EOF", settings);
+	
+	ASSERT_EQ(ir.find("i32 64, i32 4") != std::string::npos, true);
+	ASSERT_EQ(ir.find("i32 4, i32 64") == std::string::npos, true);
+	return pass();
+}
+
 ADD_TEST(TestJITPrograms, "Test running programs in test JIT");
 int TestJITPrograms()
 {
@@ -272,6 +962,51 @@ int TestJITPrograms()
 	return exitCode;
 }
 
+ADD_TEST(TestBoundsCheckedPrograms, "Test running array programs with bounds checks");
+int TestBoundsCheckedPrograms()
+{
+	int exitCode = 0;
+	auto test_path = combinePaths(getWorkingDirectory(), "test/array/");
+	auto test_files = getFilesRecursive(test_path);
+	
+	for (auto path : test_files)
+	{
+		if (llvm::sys::path::extension(path) != ".or")
+		{
+			continue;
+		}
+		
+		try
+		{
+			auto settings = new BuildSettings();
+			settings->setBoundsCheck(true);
+			
+			auto builder = new Builder(path, settings);
+			builder->compile();
+			
+			int val = builder->run();
+			if (val != 0)
+			{
+				exitCode = 1;
+				std::stringstream ss;
+				ss << path << " returned " << val;
+				ADD_ERROR(TestBoundsCheckedPrograms, ss.str());
+			}
+			
+			delete builder;
+		}
+		catch(std::exception& e)
+		{
+			std::stringstream ss;
+			ss << path << ": " << e.what();
+			ADD_ERROR(TestBoundsCheckedPrograms, ss.str());
+			exitCode = 1;
+		}
+	}
+	
+	return exitCode;
+}
+
 ADD_TEST(TestBuiltPrograms, "Test running programs in test");
 int TestBuiltPrograms()
 {